@@ -89,6 +89,9 @@ enum TangramConstants {
     /// SAT overlap detection tolerance
     static let overlapTolerance: CGFloat = 1.0
     
+    /// Exact-coincidence tolerance for checking that a recorded connection still holds
+    static let connectionSatisfiedTolerance: CGFloat = 1e-5
+    
     /// Angle snapping tolerance for rotations
     static let angleSnapTolerance: Double = 1.0
     
@@ -59,9 +59,7 @@ class ConnectionService {
             let worldVertexA = worldVerticesA[vertexA]
             let worldVertexB = worldVerticesB[vertexB]
             
-            // Check if vertices are equal with tolerance
-            let tolerance: CGFloat = 1e-5
-            if abs(worldVertexA.x - worldVertexB.x) < tolerance && abs(worldVertexA.y - worldVertexB.y) < tolerance {
+            if TangramOverlapDetector.verticesMeet(worldVertexA, worldVertexB, tolerances: .satisfied) {
                 return Constraint(
                     type: .rotation(around: worldVertexA, range: 0...360),
                     affectedPieceId: pieceBId
@@ -240,7 +238,7 @@ class ConnectionService {
         let verticesA = TangramEditorCoordinateSystem.getWorldVertices(for: pieceA)
         let verticesB = TangramEditorCoordinateSystem.getWorldVertices(for: pieceB)
         
-        let tolerance: CGFloat = 1e-5
+        let tolerances = TangramOverlapDetector.ConnectionTolerances.satisfied
         
         switch connection.type {
         case .vertexToVertex(_, let vertexA, _, let vertexB):
@@ -250,7 +248,7 @@ class ConnectionService {
             
             let pointA = verticesA[vertexA]
             let pointB = verticesB[vertexB]
-            return abs(pointA.x - pointB.x) < tolerance && abs(pointA.y - pointB.y) < tolerance
+            return TangramOverlapDetector.verticesMeet(pointA, pointB, tolerances: tolerances)
             
         case .edgeToEdge(let pieceAId, let edgeA, _, let edgeB):
             guard let pieceAObj = pieces.first(where: { $0.id == pieceAId }) else {
@@ -272,32 +270,15 @@ class ConnectionService {
             let edgeStartB = verticesB[edgeDefB.startVertex]
             let edgeEndB = verticesB[edgeDefB.endVertex]
             
-            let edgeA = (edgeStartA, edgeEndA)
-            let edgeB = (edgeStartB, edgeEndB)
-            
-            // Check if edges coincide or partially coincide
-            // Check if edges coincide (same line, overlapping)
-            // This is a simplified check - edges coincide if endpoints match
-            let aStartMatchesBStart = abs(edgeStartA.x - edgeStartB.x) < tolerance && abs(edgeStartA.y - edgeStartB.y) < tolerance
-            let aStartMatchesBEnd = abs(edgeStartA.x - edgeEndB.x) < tolerance && abs(edgeStartA.y - edgeEndB.y) < tolerance
-            let aEndMatchesBStart = abs(edgeEndA.x - edgeStartB.x) < tolerance && abs(edgeEndA.y - edgeStartB.y) < tolerance
-            let aEndMatchesBEnd = abs(edgeEndA.x - edgeEndB.x) < tolerance && abs(edgeEndA.y - edgeEndB.y) < tolerance
-            
-            if (aStartMatchesBStart && aEndMatchesBEnd) || (aStartMatchesBEnd && aEndMatchesBStart) {
-                return true
-            }
-            
-            // Check if the shorter edge lies along the longer edge
-            let lengthA = sqrt(pow(edgeEndA.x - edgeStartA.x, 2) + pow(edgeEndA.y - edgeStartA.y, 2))
-            let lengthB = sqrt(pow(edgeEndB.x - edgeStartB.x, 2) + pow(edgeEndB.y - edgeStartB.y, 2))
-            
-            if lengthA > lengthB {
-                // Check if shorter edge lies along longer edge
-                return isEdgeOnLine(edge: edgeB, line: edgeA, tolerance: tolerance)
-            } else {
-                // Check if shorter edge lies along longer edge
-                return isEdgeOnLine(edge: edgeA, line: edgeB, tolerance: tolerance)
-            }
+            // The shorter edge must lie along the longer one over its whole length
+            let lengthA = hypot(edgeEndA.x - edgeStartA.x, edgeEndA.y - edgeStartA.y)
+            let lengthB = hypot(edgeEndB.x - edgeStartB.x, edgeEndB.y - edgeStartB.y)
+            guard let contact = TangramOverlapDetector.edgeContactLength(
+                (edgeStartA, edgeEndA),
+                (edgeStartB, edgeEndB),
+                tolerances: tolerances
+            ) else { return false }
+            return contact >= min(lengthA, lengthB) - tolerances.edgeToEdge
             
         case .vertexToEdge(let pieceAId, let vertex, let pieceBId, let edge):
             guard vertex < verticesA.count,
@@ -316,47 +297,7 @@ class ConnectionService {
             let edgeStartB = verticesB[edgeDefB.startVertex]
             let edgeEndB = verticesB[edgeDefB.endVertex]
             
-            // Check if vertex lies on the edge
-            // Check if vertex lies on the edge
-            return isPointOnLineSegment(vertexPoint, edgeStartB, edgeEndB)
+            return TangramOverlapDetector.vertexOnEdge(vertexPoint, edgeStart: edgeStartB, edgeEnd: edgeEndB, tolerances: tolerances)
         }
     }
-    
-    // MARK: - Helper Methods
-    
-    private func isEdgeOnLine(edge: (CGPoint, CGPoint), line: (CGPoint, CGPoint), tolerance: CGFloat) -> Bool {
-        // Check if both endpoints of the edge lie on the line
-        return isPointOnLineSegment(edge.0, line.0, line.1, tolerance: tolerance) &&
-               isPointOnLineSegment(edge.1, line.0, line.1, tolerance: tolerance)
-    }
-    
-    private func isPointOnLineSegment(_ point: CGPoint, _ lineStart: CGPoint, _ lineEnd: CGPoint, tolerance: CGFloat = 1e-5) -> Bool {
-        // Vector from lineStart to lineEnd
-        let lineVec = CGVector(dx: lineEnd.x - lineStart.x, dy: lineEnd.y - lineStart.y)
-        // Vector from lineStart to point
-        let pointVec = CGVector(dx: point.x - lineStart.x, dy: point.y - lineStart.y)
-        
-        // Calculate parameter t for projection
-        let lineLengthSquared = lineVec.dx * lineVec.dx + lineVec.dy * lineVec.dy
-        if lineLengthSquared < tolerance {
-            // Line is essentially a point
-            return abs(point.x - lineStart.x) < tolerance && abs(point.y - lineStart.y) < tolerance
-        }
-        
-        let t = (pointVec.dx * lineVec.dx + pointVec.dy * lineVec.dy) / lineLengthSquared
-        
-        // Check if projection is within segment bounds
-        if t < -tolerance || t > 1 + tolerance {
-            return false
-        }
-        
-        // Calculate perpendicular distance
-        let projectedPoint = CGPoint(
-            x: lineStart.x + t * lineVec.dx,
-            y: lineStart.y + t * lineVec.dy
-        )
-        
-        let distance = sqrt(pow(point.x - projectedPoint.x, 2) + pow(point.y - projectedPoint.y, 2))
-        return distance < tolerance
-    }
-}
\ No newline at end of file
+}
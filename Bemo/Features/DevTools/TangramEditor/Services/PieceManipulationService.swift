@@ -303,6 +303,7 @@ class PieceManipulationService {
     }
     
     /// Calculate valid sliding range considering obstacles
+    /// Limits are exact contact distances (swept SAT); stepSize is kept for call-site compatibility
     func calculateSlideLimits(
         piece: TangramPiece,
         edge: ManipulationMode.Edge,
@@ -310,79 +311,41 @@ class PieceManipulationService {
         otherPieces: [TangramPiece],
         stepSize: Double = TangramConstants.slideStepSize
     ) -> ClosedRange<Double> {
-        // No longer need validation service - using PieceTransformEngine
-        var minValidDistance = baseRange.lowerBound
-        var maxValidDistance = baseRange.upperBound
-        
-        // Get current position along edge (assumed to be 0 for initial placement)
-        let currentPosition: Double = 0
-        
-        // Check forward (positive) direction from current position
-        for distance in stride(from: currentPosition, through: baseRange.upperBound, by: stepSize) {
-            let translation = CGAffineTransform(
-                translationX: edge.vector.dx * CGFloat(distance),
-                y: edge.vector.dy * CGFloat(distance)
-            )
-            
-            let newTransform = piece.transform.concatenating(translation)
-            let testPiece = TangramPiece(type: piece.type, transform: newTransform)
-            
-            var hasOverlap = false
-            for other in otherPieces {
-                if PieceTransformEngine.hasAreaOverlap(testPiece, other) {
-                    hasOverlap = true
-                    break
-                }
-            }
-            
-            if hasOverlap {
-                maxValidDistance = max(currentPosition, distance - stepSize)
-                break
-            }
-        }
-        
-        // Check backward (negative) direction from current position
-        for distance in stride(from: currentPosition, through: baseRange.lowerBound, by: -stepSize) {
-            let translation = CGAffineTransform(
-                translationX: edge.vector.dx * CGFloat(distance),
-                y: edge.vector.dy * CGFloat(distance)
-            )
-            
-            let newTransform = piece.transform.concatenating(translation)
-            let testPiece = TangramPiece(type: piece.type, transform: newTransform)
-            
-            var hasOverlap = false
-            for other in otherPieces {
-                if PieceTransformEngine.hasAreaOverlap(testPiece, other) {
-                    hasOverlap = true
-                    break
-                }
-            }
-            
-            if hasOverlap {
-                minValidDistance = min(currentPosition, distance + stepSize)
-                break
-            }
-        }
-        
-        return minValidDistance...maxValidDistance
+        // Current position along edge is 0 (the piece's present transform)
+        return TangramMotionSolver.slideLimits(
+            moving: TangramOverlapDetector.Shape(piece: piece),
+            direction: edge.vector,
+            baseRange: baseRange,
+            obstacles: otherPieces.map(TangramOverlapDetector.Shape.init(piece:))
+        )
     }
     
     /// Calculate the valid rotation range for a piece to prevent overlaps
+    /// Returns rotation limits in degrees relative to the current orientation, in the same −180...180
+    /// gesture range as rotationSnapAngles; the full range when the piece can turn all the way round.
+    /// stepDegrees is kept for call-site compatibility.
     func calculateRotationLimits(
         piece: TangramPiece,
         pivot: CGPoint,
         otherPieces: [TangramPiece],
         stepDegrees: Double = TangramConstants.rotationStepDegrees  // Use standard rotation steps for tangram
     ) -> (minAngle: Double, maxAngle: Double) {
-        // For vertex-to-vertex connections, test each 45° position
-        // and return the full range if any positions are valid
-        // The actual validation happens in handleRotation using PieceTransformEngine
+        let offsets = TangramEditorCoordinateSystem.getWorldVertices(for: piece).map {
+            CGPoint(x: $0.x - pivot.x, y: $0.y - pivot.y)
+        }
+        
+        guard let limits = TangramMotionSolver.rotationLimits(
+            pieceId: piece.id,
+            localOffsets: offsets,
+            pivot: pivot,
+            currentAngle: 0,
+            obstacles: otherPieces.map(TangramOverlapDetector.Shape.init(piece:))
+        ) else {
+            return (-180, 180)
+        }
         
-        // For now, return full range to allow testing all positions
-        // The centralized validation in PieceTransformEngine will handle
-        // checking each position for validity
-        return (-180, 180)
+        // Solver limits are deltas from currentAngle 0; clamp to the gesture's half-turn each way
+        return (max(-180, limits.min * 180 / .pi), min(180, limits.max * 180 / .pi))
     }
 }
 
@@ -425,6 +425,8 @@ class PieceTransformEngine {
         let step = TangramConstants.rotationStepDegrees
         let allAngles = stride(from: -180.0, through: 180.0, by: step).map { $0 }
         var validAngles: [Double] = []
+        // Stationary pieces do not change across candidate angles
+        let otherShapes = otherPieces.map(TangramOverlapDetector.Shape.init(piece:))
         
         for angle in allAngles {
             let radians = angle * .pi / 180
@@ -441,16 +443,9 @@ class PieceTransformEngine {
             // Test for overlaps
             var testPiece = rotatingPiece
             testPiece.transform = testTransform
+            let testShape = TangramOverlapDetector.Shape(piece: testPiece)
             
-            var hasOverlap = false
-            for other in otherPieces {
-                if Self.hasAreaOverlap(testPiece, other) {
-                    hasOverlap = true
-                    break
-                }
-            }
-            
-            if !hasOverlap {
+            if TangramOverlapDetector.firstOverlap(of: testShape, in: otherShapes) == nil {
                 validAngles.append(angle)
             }
         }
@@ -613,30 +608,28 @@ class PieceTransformEngine {
         var testPiece = piece
         testPiece.transform = transform
         
-        // Check 1: Overlap with other pieces
-        for other in otherPieces where other.id != piece.id {
-            // Skip overlap check if this piece is connected to the other piece
-            var isConnected = false
-            if let conn = connection {
-                switch conn.type {
-                case .vertexToVertex(let pieceAId, _, let pieceBId, _),
-                     .vertexToEdge(let pieceAId, _, let pieceBId, _),
-                     .edgeToEdge(let pieceAId, _, let pieceBId, _):
-                    isConnected = (piece.id == pieceAId && other.id == pieceBId) || 
-                                  (piece.id == pieceBId && other.id == pieceAId)
-                }
-            }
-            
-            // Only check overlap if pieces are not connected
-            if !isConnected && Self.hasAreaOverlap(testPiece, other) {
-                violations.append(ValidationViolation(
-                    type: .overlap(with: other.id),
-                    message: "Piece would overlap with another piece"
-                ))
-                break // One overlap is enough to invalidate
+        // Check 1: Overlap with other pieces, skipping the piece this one is connected to
+        var connectedIds: Set<String> = []
+        if let conn = connection {
+            switch conn.type {
+            case .vertexToVertex(let pieceAId, _, let pieceBId, _),
+                 .vertexToEdge(let pieceAId, _, let pieceBId, _),
+                 .edgeToEdge(let pieceAId, _, let pieceBId, _):
+                if piece.id == pieceAId { connectedIds.insert(pieceBId) }
+                if piece.id == pieceBId { connectedIds.insert(pieceAId) }
             }
         }
         
+        let testShape = TangramOverlapDetector.Shape(piece: testPiece)
+        let otherShapes = otherPieces.map(TangramOverlapDetector.Shape.init(piece:))
+        if let other = TangramOverlapDetector.firstOverlap(of: testShape, in: otherShapes, excluding: connectedIds) {
+            // One overlap is enough to invalidate
+            violations.append(ValidationViolation(
+                type: .overlap(with: other.pieceId),
+                message: "Piece would overlap with another piece"
+            ))
+        }
+        
         // Check 2: Connection integrity
         if let conn = connection {
             if !isConnectionMaintained(testPiece, connection: conn, otherPieces: otherPieces) {
@@ -666,102 +659,9 @@ class PieceTransformEngine {
     
     // MARK: - Overlap Detection
     
+    /// SAT overlap test; touching pieces do not overlap (see TangramOverlapDetector)
     static func hasAreaOverlap(_ pieceA: TangramPiece, _ pieceB: TangramPiece) -> Bool {
-        let verticesA = TangramEditorCoordinateSystem.getWorldVertices(for: pieceA)
-        let verticesB = TangramEditorCoordinateSystem.getWorldVertices(for: pieceB)
-        
-        // Use Separating Axis Theorem (SAT)
-        let axes = getAxes(vertices: verticesA) + getAxes(vertices: verticesB)
-        
-        // Tolerance for floating point comparisons
-        let tolerance: CGFloat = TangramConstants.overlapTolerance
-        
-        for axis in axes {
-            let projectionA = projectVertices(verticesA, onto: axis)
-            let projectionB = projectVertices(verticesB, onto: axis)
-            
-            // Check if projections are separated
-            // Use a small negative tolerance to allow touching but not overlapping
-            // A gap > -tolerance means pieces are separated or just touching
-            let gap = max(projectionA.min - projectionB.max, projectionB.min - projectionA.max)
-            
-            if gap > -tolerance {
-                // Found a separating axis - no overlap
-                return false
-            }
-        }
-        
-        // No separating axis found - pieces definitely overlap
-        // This means they have area overlap, not just touching
-        return true
-    }
-    
-    private static func areEdgesCollinearAndTouching(a1: CGPoint, a2: CGPoint, b1: CGPoint, b2: CGPoint, tolerance: CGFloat) -> Bool {
-        // Check if two edges are collinear and touching/overlapping
-        
-        // First check if they're collinear (on the same line)
-        let crossProduct1 = (a2.x - a1.x) * (b1.y - a1.y) - (a2.y - a1.y) * (b1.x - a1.x)
-        let crossProduct2 = (a2.x - a1.x) * (b2.y - a1.y) - (a2.y - a1.y) * (b2.x - a1.x)
-        
-        if abs(crossProduct1) > tolerance || abs(crossProduct2) > tolerance {
-            return false // Not collinear
-        }
-        
-        // Check if the edges overlap/touch along their length
-        // Project points onto the line and check if ranges overlap
-        let dx = a2.x - a1.x
-        let dy = a2.y - a1.y
-        let lengthSquared = dx * dx + dy * dy
-        
-        if lengthSquared < tolerance * tolerance {
-            return false // Edge too short
-        }
-        
-        // Project b1 and b2 onto the line from a1 to a2
-        let t1 = ((b1.x - a1.x) * dx + (b1.y - a1.y) * dy) / lengthSquared
-        let t2 = ((b2.x - a1.x) * dx + (b2.y - a1.y) * dy) / lengthSquared
-        
-        let minT = min(t1, t2)
-        let maxT = max(t1, t2)
-        
-        // Check if the projections overlap with the segment [0, 1]
-        return maxT >= -tolerance/sqrt(lengthSquared) && minT <= 1 + tolerance/sqrt(lengthSquared)
-    }
-    
-    private static func getAxes(vertices: [CGPoint]) -> [CGVector] {
-        var axes: [CGVector] = []
-        
-        for i in 0..<vertices.count {
-            let vertex1 = vertices[i]
-            let vertex2 = vertices[(i + 1) % vertices.count]
-            
-            // Get edge vector
-            let edge = CGVector(dx: vertex2.x - vertex1.x, dy: vertex2.y - vertex1.y)
-            
-            // Get perpendicular (normal)
-            let normal = CGVector(dx: -edge.dy, dy: edge.dx)
-            
-            // Normalize
-            let length = sqrt(normal.dx * normal.dx + normal.dy * normal.dy)
-            if length > 0.001 {
-                axes.append(CGVector(dx: normal.dx / length, dy: normal.dy / length))
-            }
-        }
-        
-        return axes
-    }
-    
-    private static func projectVertices(_ vertices: [CGPoint], onto axis: CGVector) -> (min: CGFloat, max: CGFloat) {
-        var min = CGFloat.greatestFiniteMagnitude
-        var max = -CGFloat.greatestFiniteMagnitude
-        
-        for vertex in vertices {
-            let projection = vertex.x * axis.dx + vertex.y * axis.dy
-            min = Swift.min(min, projection)
-            max = Swift.max(max, projection)
-        }
-        
-        return (min, max)
+        TangramOverlapDetector.hasAreaOverlap(pieceA, pieceB)
     }
     
     // MARK: - Connection Validation
@@ -788,12 +688,7 @@ class PieceTransformEngine {
                 return false
             }
             
-            let distance = hypot(
-                verticesThis[thisVertex].x - verticesOther[otherVertex].x,
-                verticesThis[thisVertex].y - verticesOther[otherVertex].y
-            )
-            
-            return distance < TangramConstants.vertexToVertexTolerance
+            return TangramOverlapDetector.verticesMeet(verticesThis[thisVertex], verticesOther[otherVertex])
             
         case .vertexToEdge(let pieceAId, let vertex, let pieceBId, let edge):
             let isVertexPiece = piece.id == pieceAId
@@ -816,12 +711,7 @@ class PieceTransformEngine {
                 let edgeStart = edgeVertices[edgeDef.startVertex]
                 let edgeEnd = edgeVertices[edgeDef.endVertex]
                 
-                return isPointOnLineSegment(
-                    point: vertexPoint,
-                    lineStart: edgeStart,
-                    lineEnd: edgeEnd,
-                    tolerance: TangramConstants.vertexToEdgeTolerance
-                )
+                return TangramOverlapDetector.vertexOnEdge(vertexPoint, edgeStart: edgeStart, edgeEnd: edgeEnd)
             } else {
                 // This piece has the edge - vertex piece must have its vertex on our edge
                 guard let vertexPiece = otherPieces.first(where: { $0.id == pieceAId }) else {
@@ -840,12 +730,7 @@ class PieceTransformEngine {
                 let edgeStart = edgeVertices[edgeDef.startVertex]
                 let edgeEnd = edgeVertices[edgeDef.endVertex]
                 
-                return isPointOnLineSegment(
-                    point: vertexPoint,
-                    lineStart: edgeStart,
-                    lineEnd: edgeEnd,
-                    tolerance: TangramConstants.vertexToEdgeTolerance
-                )
+                return TangramOverlapDetector.vertexOnEdge(vertexPoint, edgeStart: edgeStart, edgeEnd: edgeEnd)
             }
             
         case .edgeToEdge(let pieceAId, let edgeA, let pieceBId, let edgeB):
@@ -874,15 +759,8 @@ class PieceTransformEngine {
             let otherStart = verticesOther[otherEdgeDef.startVertex]
             let otherEnd = verticesOther[otherEdgeDef.endVertex]
             
-            // Check if edges are parallel and touching
-            let result = areEdgesParallelAndTouching(
-                edge1Start: thisStart,
-                edge1End: thisEnd,
-                edge2Start: otherStart,
-                edge2End: otherEnd
-            )
-            
-            return result
+            // Parallel and touching, end to end included
+            return TangramOverlapDetector.edgeContactLength((thisStart, thisEnd), (otherStart, otherEnd)) != nil
         }
     }
     
@@ -921,57 +799,4 @@ class PieceTransformEngine {
             y: lineStart.y + t * lineVector.dy
         )
     }
-    
-    private func isPointOnLineSegment(
-        point: CGPoint,
-        lineStart: CGPoint,
-        lineEnd: CGPoint,
-        tolerance: CGFloat
-    ) -> Bool {
-        let projected = projectPointOntoLineSegment(
-            point: point,
-            lineStart: lineStart,
-            lineEnd: lineEnd
-        )
-        
-        let distance = hypot(point.x - projected.x, point.y - projected.y)
-        return distance <= tolerance
-    }
-    
-    private func areEdgesParallelAndTouching(
-        edge1Start: CGPoint,
-        edge1End: CGPoint,
-        edge2Start: CGPoint,
-        edge2End: CGPoint
-    ) -> Bool {
-        // Calculate edge vectors
-        let v1 = CGVector(dx: edge1End.x - edge1Start.x, dy: edge1End.y - edge1Start.y)
-        let v2 = CGVector(dx: edge2End.x - edge2Start.x, dy: edge2End.y - edge2Start.y)
-        
-        let len1 = sqrt(v1.dx * v1.dx + v1.dy * v1.dy)
-        let len2 = sqrt(v2.dx * v2.dx + v2.dy * v2.dy)
-        
-        guard len1 > 0.001 && len2 > 0.001 else { return false }
-        
-        // Normalize vectors
-        let n1 = CGVector(dx: v1.dx / len1, dy: v1.dy / len1)
-        let n2 = CGVector(dx: v2.dx / len2, dy: v2.dy / len2)
-        
-        // Check if parallel (dot product should be -1 or 1)
-        let dotProduct = n1.dx * n2.dx + n1.dy * n2.dy
-        let isParallel = abs(abs(dotProduct) - 1.0) < 0.01
-        
-        if !isParallel { return false }
-        
-        // Check if edges overlap/touch
-        let tolerance: CGFloat = TangramConstants.edgeToEdgeTolerance
-        
-        // Check if any endpoint is close to the other edge
-        let s1ToE2 = isPointOnLineSegment(point: edge1Start, lineStart: edge2Start, lineEnd: edge2End, tolerance: tolerance)
-        let e1ToE2 = isPointOnLineSegment(point: edge1End, lineStart: edge2Start, lineEnd: edge2End, tolerance: tolerance)
-        let s2ToE1 = isPointOnLineSegment(point: edge2Start, lineStart: edge1Start, lineEnd: edge1End, tolerance: tolerance)
-        let e2ToE1 = isPointOnLineSegment(point: edge2End, lineStart: edge1Start, lineEnd: edge1End, tolerance: tolerance)
-        
-        return s1ToE2 || e1ToE2 || s2ToE1 || e2ToE1
-    }
-}
\ No newline at end of file
+}
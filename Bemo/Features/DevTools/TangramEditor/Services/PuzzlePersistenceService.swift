@@ -7,6 +7,7 @@
 
 import Foundation
 import SwiftUI
+import UIKit
 import OSLog
 
 class PuzzlePersistenceService {
@@ -209,20 +210,30 @@ class PuzzlePersistenceService {
     
     // MARK: - Thumbnail Generation
     
-    /// Generate thumbnail data using direct rendering (shared service requires GamePuzzleData)
+    /// Generate thumbnail data with the scanline rasterizer, off the main thread
     private func generateThumbnailData(for puzzle: TangramPuzzle, size: CGSize = CGSize(width: 200, height: 200)) async -> Data? {
-        return await MainActor.run {
-            // Create thumbnail view directly
-            let puzzleView = EditorThumbnailView(puzzle: puzzle)
-                .frame(width: size.width, height: size.height)
-                .background(Color.white)
-            
-            // Render to image using ImageRenderer
-            let renderer = ImageRenderer(content: puzzleView)
-            renderer.scale = 2.0 // Retina quality
-            
-            guard let uiImage = renderer.uiImage else { return nil }
-            return uiImage.pngData()
+        await generateThumbnails(for: [puzzle], size: size)[puzzle.id]
+    }
+    
+    /// Render thumbnails for many puzzles in one concurrent batch, keyed by puzzle id
+    private func generateThumbnails(for puzzles: [TangramPuzzle], size: CGSize = CGSize(width: 200, height: 200)) async -> [String: Data] {
+        let jobs = puzzles.map { (id: $0.id, layers: thumbnailLayers(for: $0)) }
+        return await TangramSilhouetteRasterizer.pngThumbnails(jobs, size: size)
+    }
+    
+    /// One filled layer per piece in its editor color at 80% opacity, outlined in black
+    private func thumbnailLayers(for puzzle: TangramPuzzle) -> [TangramSilhouetteRasterizer.Layer] {
+        puzzle.pieces.map { piece in
+            let polygon = TangramGeometry.vertices(for: piece.type).map {
+                CGPoint(x: $0.x * TangramConstants.visualScale,
+                        y: $0.y * TangramConstants.visualScale).applying(piece.transform)
+            }
+            var red: CGFloat = 0, green: CGFloat = 0, blue: CGFloat = 0, alpha: CGFloat = 0
+            UIColor(piece.type.color).getRed(&red, green: &green, blue: &blue, alpha: &alpha)
+            let color = TangramSilhouetteRasterizer.Color(
+                red: Float(red), green: Float(green), blue: Float(blue), alpha: Float(alpha * 0.8)
+            )
+            return TangramSilhouetteRasterizer.Layer(polygons: [polygon], color: color, outline: .black)
         }
     }
     
@@ -248,11 +259,28 @@ class PuzzlePersistenceService {
             let puzzleDTOs = try await supabase.fetchOfficialTangramPuzzles()
             Logger.tangramEditor.info("Fetched \(puzzleDTOs.count) official puzzles from Supabase")
             
-            // Convert DTOs to puzzle models and cache locally
-            var syncedPuzzles: [TangramPuzzle] = []
+            // Convert DTOs to puzzle models
+            var converted: [(dto: TangramPuzzleDTO, puzzle: TangramPuzzle)] = []
             for dto in puzzleDTOs {
                 do {
-                    let puzzle = try dto.toTangramPuzzle()
+                    converted.append((dto, try dto.toTangramPuzzle()))
+                } catch {
+                    Logger.tangramEditor.error("Failed to convert puzzle DTO \(dto.puzzle_id): \(error.localizedDescription)")
+                }
+            }
+            
+            // Render all missing thumbnails in one background batch instead of one per save
+            let thumbnails = await generateThumbnails(for: converted.map { $0.puzzle }.filter { $0.thumbnailData == nil })
+            
+            // Cache puzzles locally
+            var syncedPuzzles: [TangramPuzzle] = []
+            for (dto, decoded) in converted {
+                do {
+                    var puzzle = decoded
+                    if puzzle.thumbnailData == nil, let thumbnailData = thumbnails[puzzle.id] {
+                        try saveThumbnail(thumbnailData, for: puzzle.id)
+                        puzzle.thumbnailData = thumbnailData
+                    }
                     
                     // Cache puzzle locally
                     _ = try await savePuzzleLocally(puzzle)
@@ -269,7 +297,7 @@ class PuzzlePersistenceService {
                     
                     syncedPuzzles.append(puzzle)
                 } catch {
-                    Logger.tangramEditor.error("Failed to convert puzzle DTO \(dto.puzzle_id): \(error.localizedDescription)")
+                    Logger.tangramEditor.error("Failed to cache puzzle \(dto.puzzle_id): \(error.localizedDescription)")
                 }
             }
             
@@ -351,109 +379,3 @@ class PuzzlePersistenceService {
 // MARK: - Supporting Types
 
 // PuzzleMetadata moved to Models/TangramPuzzleData.swift
-
-// MARK: - Editor Thumbnail View
-
-/// Simple thumbnail view for TangramPuzzle that doesn't require GamePuzzleData conversion
-private struct EditorThumbnailView: View {
-    let puzzle: TangramPuzzle
-    
-    var body: some View {
-        GeometryReader { geometry in
-            ZStack {
-                ForEach(puzzle.pieces) { piece in
-                    EditorPieceShape(piece: piece, puzzleBounds: calculatePuzzleBounds())
-                        .fill(piece.type.color.opacity(0.8))
-                        .overlay(
-                            EditorPieceShape(piece: piece, puzzleBounds: calculatePuzzleBounds())
-                                .stroke(Color.black, lineWidth: 0.5)
-                        )
-                }
-            }
-            .scaleEffect(calculateScale(for: geometry.size))
-            .position(x: geometry.size.width / 2, y: geometry.size.height / 2)
-        }
-    }
-    
-    func calculatePuzzleBounds() -> CGRect {
-        var minX = CGFloat.greatestFiniteMagnitude
-        var minY = CGFloat.greatestFiniteMagnitude
-        var maxX = -CGFloat.greatestFiniteMagnitude
-        var maxY = -CGFloat.greatestFiniteMagnitude
-        
-        for piece in puzzle.pieces {
-            let vertices = TangramGeometry.vertices(for: piece.type)
-            let scaledVertices = vertices.map { 
-                CGPoint(x: $0.x * TangramConstants.visualScale, 
-                        y: $0.y * TangramConstants.visualScale)
-            }
-            let transformed = scaledVertices.map { $0.applying(piece.transform) }
-            
-            for vertex in transformed {
-                minX = min(minX, vertex.x)
-                minY = min(minY, vertex.y)
-                maxX = max(maxX, vertex.x)
-                maxY = max(maxY, vertex.y)
-            }
-        }
-        
-        guard minX < CGFloat.greatestFiniteMagnitude else {
-            return .zero
-        }
-        
-        return CGRect(x: minX, y: minY, width: maxX - minX, height: maxY - minY)
-    }
-    
-    func calculateScale(for size: CGSize) -> CGFloat {
-        let bounds = calculatePuzzleBounds()
-        guard bounds.width > 0 && bounds.height > 0 else { return 1.0 }
-        
-        return min(
-            size.width / bounds.width * 0.8,
-            size.height / bounds.height * 0.8
-        )
-    }
-}
-
-private struct EditorPieceShape: Shape {
-    let piece: TangramPiece
-    let puzzleBounds: CGRect
-    
-    func path(in rect: CGRect) -> Path {
-        let vertices = TangramGeometry.vertices(for: piece.type)
-        let scaledVertices = vertices.map { 
-            CGPoint(x: $0.x * TangramConstants.visualScale, 
-                    y: $0.y * TangramConstants.visualScale)
-        }
-        let transformed = scaledVertices.map { $0.applying(piece.transform) }
-        
-        var path = Path()
-        
-        if let first = transformed.first {
-            let normalizedFirst = normalizePoint(first, in: rect)
-            path.move(to: normalizedFirst)
-            
-            for vertex in transformed.dropFirst() {
-                let normalizedVertex = normalizePoint(vertex, in: rect)
-                path.addLine(to: normalizedVertex)
-            }
-            path.closeSubpath()
-        }
-        
-        return path
-    }
-    
-    func normalizePoint(_ point: CGPoint, in rect: CGRect) -> CGPoint {
-        guard puzzleBounds.width > 0 && puzzleBounds.height > 0 else {
-            return CGPoint(x: rect.midX, y: rect.midY)
-        }
-        
-        let normalizedX = (point.x - puzzleBounds.minX) / puzzleBounds.width
-        let normalizedY = (point.y - puzzleBounds.minY) / puzzleBounds.height
-        
-        return CGPoint(
-            x: normalizedX * rect.width,
-            y: normalizedY * rect.height
-        )
-    }
-}
\ No newline at end of file
@@ -12,7 +12,7 @@
 // RESPONSIBILITIES:
 // - Transform validation (as-placed, no re-centering)
 // - Connection integrity checking (ALL connections, not just first)
-// - Overlap detection using SAT
+// - Overlap detection using SAT (shared TangramOverlapDetector)
 // - Tolerance management (single, consistent definitions)
 // - Parallelogram remapping (centralized)
 //
@@ -302,12 +302,7 @@ class TangramValidationService {
             let edgeStart = edgeVertices[edgeDef.startVertex]
             let edgeEnd = edgeVertices[edgeDef.endVertex]
             
-            if !isPointOnLineSegment(
-                point: vertexPoint,
-                lineStart: edgeStart,
-                lineEnd: edgeEnd,
-                tolerance: ToleranceType.vertexToEdge.value
-            ) {
+            if !TangramOverlapDetector.vertexOnEdge(vertexPoint, edgeStart: edgeStart, edgeEnd: edgeEnd) {
                 return [ValidationViolation(
                     type: .connectionBroken(type: "vertex-to-edge"),
                     message: "Vertex is not on edge"
@@ -344,12 +339,7 @@ class TangramValidationService {
             let edgeStart = edgeVertices[edgeDef.startVertex]
             let edgeEnd = edgeVertices[edgeDef.endVertex]
             
-            if !isPointOnLineSegment(
-                point: vertexPoint,
-                lineStart: edgeStart,
-                lineEnd: edgeEnd,
-                tolerance: ToleranceType.vertexToEdge.value
-            ) {
+            if !TangramOverlapDetector.vertexOnEdge(vertexPoint, edgeStart: edgeStart, edgeEnd: edgeEnd) {
                 return [ValidationViolation(
                     type: .connectionBroken(type: "vertex-to-edge"),
                     message: "Vertex is not on edge"
@@ -402,13 +392,7 @@ class TangramValidationService {
         let otherStart = verticesOther[otherEdgeDef.startVertex]
         let otherEnd = verticesOther[otherEdgeDef.endVertex]
         
-        if !areEdgesParallelAndTouching(
-            edge1Start: thisStart,
-            edge1End: thisEnd,
-            edge2Start: otherStart,
-            edge2End: otherEnd,
-            tolerance: ToleranceType.edgeToEdge.value
-        ) {
+        if TangramOverlapDetector.edgeContactLength((thisStart, thisEnd), (otherStart, otherEnd)) == nil {
             return [ValidationViolation(
                 type: .connectionBroken(type: "edge-to-edge"),
                 message: "Edges are not parallel and touching"
@@ -439,19 +423,21 @@ class TangramValidationService {
             }
         }
         
-        for other in otherPieces where other.id != piece.id {
-            // Skip overlap check for directly connected piece
-            if let excludeId = excludePieceId, other.id == excludeId {
-                continue
-            }
-            
-            if hasAreaOverlap(piece, other) {
-                violations.append(ValidationViolation(
-                    type: .overlap(with: other.id),
-                    message: "Piece overlaps with \(other.type.rawValue)"
-                ))
-                break // One overlap is enough
-            }
+        let shape = TangramOverlapDetector.Shape(piece: piece)
+        let otherShapes = otherPieces.map(TangramOverlapDetector.Shape.init(piece:))
+        let excluded: Set<String> = excludePieceId.map { [$0] } ?? []
+        
+        // Skip overlap check for directly connected piece; one overlap is enough
+        if let overlapping = TangramOverlapDetector.firstOverlap(
+            of: shape,
+            in: otherShapes,
+            excluding: excluded,
+            tolerance: ToleranceType.overlap.value
+        ), let other = otherPieces.first(where: { $0.id == overlapping.pieceId }) {
+            violations.append(ValidationViolation(
+                type: .overlap(with: other.id),
+                message: "Piece overlaps with \(other.type.rawValue)"
+            ))
         }
         
         return violations
@@ -482,132 +468,8 @@ class TangramValidationService {
         return []
     }
     
-    // MARK: - SAT Overlap Detection
-    
-    private func hasAreaOverlap(_ pieceA: TangramPiece, _ pieceB: TangramPiece) -> Bool {
-        let verticesA = TangramEditorCoordinateSystem.getWorldVertices(for: pieceA)
-        let verticesB = TangramEditorCoordinateSystem.getWorldVertices(for: pieceB)
-        
-        let axes = getAxes(vertices: verticesA) + getAxes(vertices: verticesB)
-        let tolerance = ToleranceType.overlap.value
-        
-        for axis in axes {
-            let projectionA = projectVertices(verticesA, onto: axis)
-            let projectionB = projectVertices(verticesB, onto: axis)
-            
-            let gap = max(projectionA.min - projectionB.max, projectionB.min - projectionA.max)
-            
-            if gap > -tolerance {
-                return false // Found separating axis
-            }
-        }
-        
-        return true // No separating axis found - pieces overlap
-    }
-    
-    private func getAxes(vertices: [CGPoint]) -> [CGVector] {
-        var axes: [CGVector] = []
-        
-        for i in 0..<vertices.count {
-            let vertex1 = vertices[i]
-            let vertex2 = vertices[(i + 1) % vertices.count]
-            
-            let edge = CGVector(dx: vertex2.x - vertex1.x, dy: vertex2.y - vertex1.y)
-            let normal = CGVector(dx: -edge.dy, dy: edge.dx)
-            
-            let length = sqrt(normal.dx * normal.dx + normal.dy * normal.dy)
-            if length > 0.001 {
-                axes.append(CGVector(dx: normal.dx / length, dy: normal.dy / length))
-            }
-        }
-        
-        return axes
-    }
-    
-    private func projectVertices(_ vertices: [CGPoint], onto axis: CGVector) -> (min: CGFloat, max: CGFloat) {
-        var min = CGFloat.greatestFiniteMagnitude
-        var max = -CGFloat.greatestFiniteMagnitude
-        
-        for vertex in vertices {
-            let projection = vertex.x * axis.dx + vertex.y * axis.dy
-            min = Swift.min(min, projection)
-            max = Swift.max(max, projection)
-        }
-        
-        return (min, max)
-    }
-    
     // MARK: - Geometry Helpers
     
-    private func isPointOnLineSegment(
-        point: CGPoint,
-        lineStart: CGPoint,
-        lineEnd: CGPoint,
-        tolerance: CGFloat
-    ) -> Bool {
-        let projected = projectPointOntoLineSegment(
-            point: point,
-            lineStart: lineStart,
-            lineEnd: lineEnd
-        )
-        
-        let distance = hypot(point.x - projected.x, point.y - projected.y)
-        return distance <= tolerance
-    }
-    
-    private func projectPointOntoLineSegment(
-        point: CGPoint,
-        lineStart: CGPoint,
-        lineEnd: CGPoint
-    ) -> CGPoint {
-        let lineVector = CGVector(dx: lineEnd.x - lineStart.x, dy: lineEnd.y - lineStart.y)
-        let lineLength = sqrt(lineVector.dx * lineVector.dx + lineVector.dy * lineVector.dy)
-        
-        if lineLength < 0.001 {
-            return lineStart
-        }
-        
-        let toPoint = CGVector(dx: point.x - lineStart.x, dy: point.y - lineStart.y)
-        let t = max(0, min(1, (toPoint.dx * lineVector.dx + toPoint.dy * lineVector.dy) / (lineLength * lineLength)))
-        
-        return CGPoint(
-            x: lineStart.x + t * lineVector.dx,
-            y: lineStart.y + t * lineVector.dy
-        )
-    }
-    
-    private func areEdgesParallelAndTouching(
-        edge1Start: CGPoint,
-        edge1End: CGPoint,
-        edge2Start: CGPoint,
-        edge2End: CGPoint,
-        tolerance: CGFloat
-    ) -> Bool {
-        let v1 = CGVector(dx: edge1End.x - edge1Start.x, dy: edge1End.y - edge1Start.y)
-        let v2 = CGVector(dx: edge2End.x - edge2Start.x, dy: edge2End.y - edge2Start.y)
-        
-        let len1 = sqrt(v1.dx * v1.dx + v1.dy * v1.dy)
-        let len2 = sqrt(v2.dx * v2.dx + v2.dy * v2.dy)
-        
-        guard len1 > 0.001 && len2 > 0.001 else { return false }
-        
-        let n1 = CGVector(dx: v1.dx / len1, dy: v1.dy / len1)
-        let n2 = CGVector(dx: v2.dx / len2, dy: v2.dy / len2)
-        
-        let dotProduct = n1.dx * n2.dx + n1.dy * n2.dy
-        let isParallel = abs(abs(dotProduct) - 1.0) < 0.01
-        
-        if !isParallel { return false }
-        
-        // Check if edges overlap/touch
-        let s1ToE2 = isPointOnLineSegment(point: edge1Start, lineStart: edge2Start, lineEnd: edge2End, tolerance: tolerance)
-        let e1ToE2 = isPointOnLineSegment(point: edge1End, lineStart: edge2Start, lineEnd: edge2End, tolerance: tolerance)
-        let s2ToE1 = isPointOnLineSegment(point: edge2Start, lineStart: edge1Start, lineEnd: edge1End, tolerance: tolerance)
-        let e2ToE1 = isPointOnLineSegment(point: edge2End, lineStart: edge1Start, lineEnd: edge1End, tolerance: tolerance)
-        
-        return s1ToE2 || e1ToE2 || s2ToE1 || e2ToE1
-    }
-    
     private func isValidTransform(_ transform: CGAffineTransform) -> Bool {
         // Check for degenerate transform (determinant near zero)
         let determinant = transform.a * transform.d - transform.b * transform.c
@@ -0,0 +1,198 @@
+//
+//  TangramMotionSolver.swift
+//  Bemo
+//
+//  Analytic feasible ranges for constrained editor motion (slide along an edge, rotate about a pivot)
+//
+
+// WHAT: Computes where a sliding or rotating piece first contacts obstacles, using the same SAT predicate as TangramOverlapDetector
+// ARCHITECTURE: Utility used by PieceManipulationService to derive slide and rotation limits without trial placements
+// USAGE: slideLimits(...) for edge slides, rotationLimits(...) for single-vertex pivots
+
+import Foundation
+import CoreGraphics
+
+enum TangramMotionSolver {
+
+    // MARK: - Sliding
+
+    /// Open parameter intervals (distance along `direction`) where the moving shape overlaps an obstacle.
+    /// Translation keeps every axis fixed, so each axis contributes one linear interval and the
+    /// blocked set per obstacle is their intersection (swept SAT).
+    static func slideBlockedIntervals(
+        moving: TangramOverlapDetector.Shape,
+        direction: CGVector,
+        obstacles: [TangramOverlapDetector.Shape],
+        tolerance: CGFloat = TangramConstants.overlapTolerance
+    ) -> [(lower: Double, upper: Double)] {
+        var intervals: [(lower: Double, upper: Double)] = []
+        for obstacle in obstacles where obstacle.pieceId != moving.pieceId {
+            var lower = -Double.infinity
+            var upper = Double.infinity
+            for axis in moving.axes + obstacle.axes {
+                let a = project(moving.vertices, onto: axis)
+                let b = project(obstacle.vertices, onto: axis)
+                let speed = Double(direction.dx * axis.dx + direction.dy * axis.dy)
+                // Overlap on this axis while b.min - a.max + tol < speed * t < b.max - a.min - tol
+                let low = Double(b.min - a.max + tolerance)
+                let high = Double(b.max - a.min - tolerance)
+                if abs(speed) < Double(TangramConstants.fineTolerance) {
+                    if !(low < 0 && 0 < high) { lower = .infinity; break }
+                    continue
+                }
+                let t0 = low / speed, t1 = high / speed
+                lower = max(lower, min(t0, t1))
+                upper = min(upper, max(t0, t1))
+                if lower >= upper { break }
+            }
+            if lower < upper { intervals.append((lower, upper)) }
+        }
+        return intervals
+    }
+
+    /// Exact slide range around the current position (0) within baseRange
+    static func slideLimits(
+        moving: TangramOverlapDetector.Shape,
+        direction: CGVector,
+        baseRange: ClosedRange<Double>,
+        obstacles: [TangramOverlapDetector.Shape],
+        tolerance: CGFloat = TangramConstants.overlapTolerance
+    ) -> ClosedRange<Double> {
+        let blocked = slideBlockedIntervals(moving: moving, direction: direction, obstacles: obstacles, tolerance: tolerance)
+        var maxValid = baseRange.upperBound
+        var minValid = baseRange.lowerBound
+
+        for interval in blocked {
+            // Forward: first contact at or after the current position
+            if baseRange.upperBound >= 0, interval.upper > 0 {
+                let contact = max(interval.lower, 0)
+                if contact < baseRange.upperBound || interval.lower < 0 {
+                    maxValid = min(maxValid, contact)
+                }
+            }
+            // Backward: first contact at or before the current position
+            if baseRange.lowerBound <= 0, interval.lower < 0 {
+                let contact = min(interval.upper, 0)
+                if contact > baseRange.lowerBound || interval.upper > 0 {
+                    minValid = max(minValid, contact)
+                }
+            }
+        }
+        return min(minValid, maxValid)...maxValid
+    }
+
+    // MARK: - Rotation
+
+    /// Feasible orientation range (radians, absolute) reachable from `currentAngle` by rotating about `pivot`
+    /// without overlapping any obstacle. `localOffsets` are the piece's unrotated vertices relative to the
+    /// pivot vertex. Returns nil when the full turn is free.
+    static func rotationLimits(
+        pieceId: String,
+        localOffsets: [CGPoint],
+        pivot: CGPoint,
+        currentAngle: Double,
+        obstacles: [TangramOverlapDetector.Shape],
+        tolerance: CGFloat = TangramConstants.overlapTolerance
+    ) -> (min: Double, max: Double)? {
+        let obstacles = obstacles.filter { $0.pieceId != pieceId }
+        guard !obstacles.isEmpty, !localOffsets.isEmpty else { return nil }
+
+        // Overlap state can only change where some SAT gap equals -tolerance; every such
+        // condition reduces to r·cos(θ + φ) = c, so collect its roots as candidate events.
+        var events: [Double] = []
+        let localShape = TangramOverlapDetector.Shape(pieceId: pieceId, vertices: localOffsets)
+        for obstacle in obstacles {
+            // Obstacle axes: rotating vertex projections meet the obstacle's extent
+            for axis in obstacle.axes {
+                let extent = project(obstacle.vertices, onto: axis)
+                let pivotProjection = pivot.x * axis.dx + pivot.y * axis.dy
+                for offset in localOffsets {
+                    for bound in [extent.min - tolerance, extent.min + tolerance, extent.max - tolerance, extent.max + tolerance] {
+                        // axis · R(θ)offset = bound - axis · pivot
+                        appendRoots(vector: offset, against: axis, equals: bound - pivotProjection, into: &events)
+                    }
+                }
+            }
+            // Moving axes: obstacle vertex projections meet the rotating piece's extent
+            for localAxis in localShape.axes {
+                let extent = project(localOffsets, onto: localAxis)
+                for vertex in obstacle.vertices {
+                    let relative = CGPoint(x: vertex.x - pivot.x, y: vertex.y - pivot.y)
+                    for bound in [extent.min - tolerance, extent.min + tolerance, extent.max - tolerance, extent.max + tolerance] {
+                        // R(θ)localAxis · relative = bound  ⇔  localAxis · R(-θ)relative = bound
+                        appendRoots(vector: relative, against: localAxis, equals: bound, into: &events, reversed: true)
+                    }
+                }
+            }
+        }
+
+        // Sweep outward from the current angle in both directions; state is constant between events
+        let turn = 2 * Double.pi
+        let offsets = events
+            .map { wrap($0 - currentAngle, into: turn) }
+            .filter { $0 > 0 && $0 < turn }
+            .sorted()
+
+        func isBlocked(_ delta: Double) -> Bool {
+            let angle = currentAngle + delta
+            let c = CGFloat(cos(angle)), s = CGFloat(sin(angle))
+            let vertices = localOffsets.map { CGPoint(x: pivot.x + $0.x * c - $0.y * s, y: pivot.y + $0.x * s + $0.y * c) }
+            let shape = TangramOverlapDetector.Shape(pieceId: pieceId, vertices: vertices)
+            return TangramOverlapDetector.firstOverlap(of: shape, in: obstacles, tolerance: tolerance) != nil
+        }
+
+        let bounds = [0] + offsets + [turn]
+        var forward: Double?
+        for k in 0..<(bounds.count - 1) where isBlocked((bounds[k] + bounds[k + 1]) / 2) {
+            forward = bounds[k]
+            break
+        }
+        guard let maxDelta = forward else { return nil }
+
+        var minDelta = maxDelta - turn
+        for k in stride(from: bounds.count - 1, to: 0, by: -1) where isBlocked((bounds[k] + bounds[k - 1]) / 2) {
+            minDelta = bounds[k] - turn
+            break
+        }
+        return (currentAngle + minDelta, currentAngle + maxDelta)
+    }
+
+    // MARK: - Helpers
+
+    private static func project(_ vertices: [CGPoint], onto axis: CGVector) -> (min: CGFloat, max: CGFloat) {
+        var lo = CGFloat.greatestFiniteMagnitude
+        var hi = -CGFloat.greatestFiniteMagnitude
+        for v in vertices {
+            let d = v.x * axis.dx + v.y * axis.dy
+            lo = min(lo, d)
+            hi = max(hi, d)
+        }
+        return (lo, hi)
+    }
+
+    /// Roots θ of axis · R(±θ)vector = value
+    private static func appendRoots(
+        vector: CGPoint,
+        against axis: CGVector,
+        equals value: CGFloat,
+        into events: inout [Double],
+        reversed: Bool = false
+    ) {
+        let radius = Double(hypot(vector.x, vector.y))
+        guard radius > Double(TangramConstants.fineTolerance) else { return }
+        let ratio = Double(value) / radius
+        guard abs(ratio) <= 1 else { return }
+        // axis · R(θ)v = |v| cos(θ + angle(v) - angle(axis))
+        let phase = atan2(Double(vector.y), Double(vector.x)) - atan2(Double(axis.dy), Double(axis.dx))
+        let spread = acos(ratio)
+        for root in [spread - phase, -spread - phase] {
+            // With R(-θ) the sign of θ flips
+            events.append(reversed ? -root : root)
+        }
+    }
+
+    private static func wrap(_ value: Double, into period: Double) -> Double {
+        let r = value.truncatingRemainder(dividingBy: period)
+        return r < 0 ? r + period : r
+    }
+}
@@ -0,0 +1,202 @@
+//
+//  TangramOverlapDetector.swift
+//  Bemo
+//
+//  Shared separating-axis overlap and connection contact engine for editor pieces
+//
+
+// WHAT: Single SAT implementation with per-shape precomputed axes and an AABB broadphase, plus vertex/edge contact solvers
+// ARCHITECTURE: Utility used by PieceTransformEngine, TangramValidationService, PieceManipulationService and ConnectionService
+// USAGE: Build a Shape once per piece/transform, then test it against others with hasAreaOverlap/firstOverlap;
+//        check connections with verticesMeet/vertexOnEdge/edgeContactLength and a ConnectionTolerances preset
+
+import Foundation
+import CoreGraphics
+
+enum TangramOverlapDetector {
+
+    // MARK: - Shape
+
+    /// World-space polygon with its SAT axes and bounds computed once
+    struct Shape {
+        let pieceId: String
+        let vertices: [CGPoint]
+        /// Unit edge normals with parallel duplicates removed (a square contributes 2, a triangle 3)
+        let axes: [CGVector]
+        let bounds: CGRect
+
+        init(piece: TangramPiece) {
+            self.init(pieceId: piece.id, vertices: TangramEditorCoordinateSystem.getWorldVertices(for: piece))
+        }
+
+        init(pieceId: String, vertices: [CGPoint]) {
+            self.pieceId = pieceId
+            self.vertices = vertices
+            self.axes = TangramOverlapDetector.uniqueAxes(vertices: vertices)
+
+            var minX = CGFloat.greatestFiniteMagnitude, minY = CGFloat.greatestFiniteMagnitude
+            var maxX = -CGFloat.greatestFiniteMagnitude, maxY = -CGFloat.greatestFiniteMagnitude
+            for v in vertices {
+                minX = min(minX, v.x); maxX = max(maxX, v.x)
+                minY = min(minY, v.y); maxY = max(maxY, v.y)
+            }
+            self.bounds = vertices.isEmpty ? .null : CGRect(x: minX, y: minY, width: maxX - minX, height: maxY - minY)
+        }
+    }
+
+    // MARK: - Overlap Queries
+
+    /// True when the shapes share area deeper than tolerance; touching edges and vertices do not count
+    static func hasAreaOverlap(
+        _ a: Shape,
+        _ b: Shape,
+        tolerance: CGFloat = TangramConstants.overlapTolerance
+    ) -> Bool {
+        // Broadphase: disjoint bounds imply a strictly separating axis, which SAT would also find
+        if a.bounds.minX > b.bounds.maxX || b.bounds.minX > a.bounds.maxX ||
+           a.bounds.minY > b.bounds.maxY || b.bounds.minY > a.bounds.maxY {
+            return false
+        }
+
+        for axis in a.axes where isSeparating(axis, a.vertices, b.vertices, tolerance: tolerance) {
+            return false
+        }
+        for axis in b.axes where isSeparating(axis, a.vertices, b.vertices, tolerance: tolerance) {
+            return false
+        }
+        // No separating axis found - pieces have area overlap, not just touching
+        return true
+    }
+
+    static func hasAreaOverlap(
+        _ pieceA: TangramPiece,
+        _ pieceB: TangramPiece,
+        tolerance: CGFloat = TangramConstants.overlapTolerance
+    ) -> Bool {
+        hasAreaOverlap(Shape(piece: pieceA), Shape(piece: pieceB), tolerance: tolerance)
+    }
+
+    /// First shape in `others` that overlaps `shape`, skipping the shape itself and any excluded ids
+    static func firstOverlap(
+        of shape: Shape,
+        in others: [Shape],
+        excluding excludedIds: Set<String> = [],
+        tolerance: CGFloat = TangramConstants.overlapTolerance
+    ) -> Shape? {
+        others.first { other in
+            other.pieceId != shape.pieceId &&
+            !excludedIds.contains(other.pieceId) &&
+            hasAreaOverlap(shape, other, tolerance: tolerance)
+        }
+    }
+
+    // MARK: - Connection Solvers
+
+    /// Contact distance per connection kind; callers pick a preset instead of their own constants
+    struct ConnectionTolerances: Equatable {
+        var vertexToVertex: CGFloat
+        var vertexToEdge: CGFloat
+        var edgeToEdge: CGFloat
+
+        /// Loose contact used while dragging and validating placements
+        static let contact = ConnectionTolerances(
+            vertexToVertex: TangramConstants.vertexToVertexTolerance,
+            vertexToEdge: TangramConstants.vertexToEdgeTolerance,
+            edgeToEdge: TangramConstants.edgeToEdgeTolerance
+        )
+        /// Exact coincidence for checking that a recorded connection still holds
+        static let satisfied = ConnectionTolerances(
+            vertexToVertex: TangramConstants.connectionSatisfiedTolerance,
+            vertexToEdge: TangramConstants.connectionSatisfiedTolerance,
+            edgeToEdge: TangramConstants.connectionSatisfiedTolerance
+        )
+    }
+
+    static func verticesMeet(_ a: CGPoint, _ b: CGPoint, tolerances: ConnectionTolerances = .contact) -> Bool {
+        hypot(a.x - b.x, a.y - b.y) <= tolerances.vertexToVertex
+    }
+
+    /// True when the vertex lies within tolerance of the edge segment (endpoints included)
+    static func vertexOnEdge(
+        _ vertex: CGPoint,
+        edgeStart: CGPoint,
+        edgeEnd: CGPoint,
+        tolerances: ConnectionTolerances = .contact
+    ) -> Bool {
+        distance(from: vertex, toSegment: edgeStart, edgeEnd) <= tolerances.vertexToEdge
+    }
+
+    /// Length along which two edges lie on each other, or nil when the shorter edge leaves the
+    /// longer edge's line by more than tolerance or the edges do not reach each other.
+    /// Edges that only meet end to end give 0.
+    static func edgeContactLength(
+        _ a: (start: CGPoint, end: CGPoint),
+        _ b: (start: CGPoint, end: CGPoint),
+        tolerances: ConnectionTolerances = .contact
+    ) -> CGFloat? {
+        let lengthA = hypot(a.end.x - a.start.x, a.end.y - a.start.y)
+        let lengthB = hypot(b.end.x - b.start.x, b.end.y - b.start.y)
+        guard lengthA > 0.001, lengthB > 0.001 else { return nil }
+        let (track, slider, trackLength) = lengthA >= lengthB ? (a, b, lengthA) : (b, a, lengthB)
+        let direction = CGVector(dx: (track.end.x - track.start.x) / trackLength, dy: (track.end.y - track.start.y) / trackLength)
+
+        // Both slider endpoints on the track's line: parallel and no gap between the edges
+        func offset(_ p: CGPoint) -> (along: CGFloat, across: CGFloat) {
+            let dx = p.x - track.start.x, dy = p.y - track.start.y
+            return (dx * direction.dx + dy * direction.dy, abs(dx * direction.dy - dy * direction.dx))
+        }
+        let s0 = offset(slider.start), s1 = offset(slider.end)
+        let tolerance = tolerances.edgeToEdge
+        guard s0.across <= tolerance, s1.across <= tolerance else { return nil }
+
+        let overlap = min(trackLength, max(s0.along, s1.along)) - max(0, min(s0.along, s1.along))
+        guard overlap >= -tolerance else { return nil }
+        return max(0, overlap)
+    }
+
+    private static func distance(from point: CGPoint, toSegment start: CGPoint, _ end: CGPoint) -> CGFloat {
+        let dx = end.x - start.x, dy = end.y - start.y
+        let lengthSquared = dx * dx + dy * dy
+        guard lengthSquared > 0 else { return hypot(point.x - start.x, point.y - start.y) }
+        let t = max(0, min(1, ((point.x - start.x) * dx + (point.y - start.y) * dy) / lengthSquared))
+        return hypot(point.x - (start.x + t * dx), point.y - (start.y + t * dy))
+    }
+
+    // MARK: - SAT
+
+    private static func isSeparating(_ axis: CGVector, _ a: [CGPoint], _ b: [CGPoint], tolerance: CGFloat) -> Bool {
+        let projectionA = project(a, onto: axis)
+        let projectionB = project(b, onto: axis)
+        // A gap > -tolerance means pieces are separated or just touching
+        let gap = max(projectionA.min - projectionB.max, projectionB.min - projectionA.max)
+        return gap > -tolerance
+    }
+
+    private static func project(_ vertices: [CGPoint], onto axis: CGVector) -> (min: CGFloat, max: CGFloat) {
+        var lo = CGFloat.greatestFiniteMagnitude
+        var hi = -CGFloat.greatestFiniteMagnitude
+        for vertex in vertices {
+            let projection = vertex.x * axis.dx + vertex.y * axis.dy
+            lo = min(lo, projection)
+            hi = max(hi, projection)
+        }
+        return (lo, hi)
+    }
+
+    /// Edge normals; an axis and its negation give the same gap, so parallel edges are tested once
+    private static func uniqueAxes(vertices: [CGPoint]) -> [CGVector] {
+        var axes: [CGVector] = []
+        axes.reserveCapacity(vertices.count)
+        for i in 0..<vertices.count {
+            let v1 = vertices[i]
+            let v2 = vertices[(i + 1) % vertices.count]
+            let normal = CGVector(dx: -(v2.y - v1.y), dy: v2.x - v1.x)
+            let length = sqrt(normal.dx * normal.dx + normal.dy * normal.dy)
+            guard length > 0.001 else { continue }
+            let axis = CGVector(dx: normal.dx / length, dy: normal.dy / length)
+            let isDuplicate = axes.contains { abs($0.dx * axis.dy - $0.dy * axis.dx) < TangramConstants.fineTolerance }
+            if !isDuplicate { axes.append(axis) }
+        }
+        return axes
+    }
+}
@@ -67,14 +67,9 @@ extension TangramEditorViewModel {
         testPiece.transform = transform
         
         // Check for overlaps with other pieces
-        let otherPieces = puzzle.pieces.filter { $0.id != pieceId }
-        for otherPiece in otherPieces {
-            if PieceTransformEngine.hasAreaOverlap(testPiece, otherPiece) {
-                return false
-            }
-        }
-        
-        return true
+        let testShape = TangramOverlapDetector.Shape(piece: testPiece)
+        let otherShapes = puzzle.pieces.map(TangramOverlapDetector.Shape.init(piece:))
+        return TangramOverlapDetector.firstOverlap(of: testShape, in: otherShapes) == nil
     }
     
     /// Validate connection points selection
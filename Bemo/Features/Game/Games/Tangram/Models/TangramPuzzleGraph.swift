@@ -0,0 +1,220 @@
+//
+//  TangramPuzzleGraph.swift
+//  Bemo
+//
+//  Compiled target adjacency graph for hint selection
+//
+
+// WHAT: Immutable per-puzzle target adjacency (bitsets), shared edge lengths and SK position table, compiled once per puzzle
+// ARCHITECTURE: Model in MVVM-S, owned and cached by TangramHintEngine
+// USAGE: Build with init(puzzle:), convert id sets to masks, then use component/frontier bit operations
+
+import Foundation
+import CoreGraphics
+
+/// Compact target graph so hint selection becomes bitset operations instead of repeated polygon tests
+struct TangramPuzzleGraph {
+
+    // MARK: - Properties
+
+    let puzzleId: String
+    /// Target ids in puzzle order; bit i of a mask refers to targetIds[i]
+    let targetIds: [String]
+    /// Target piece types in the same order as targetIds
+    let pieceTypes: [TangramPieceType]
+    /// Target transform translation in SK space (the position hint scoring measures against)
+    let positionsSK: [CGPoint]
+    /// Target outline in SK space, same order as targetIds
+    let polygonsSK: [[CGPoint]]
+
+    private let targetPieces: [GamePuzzleData.TargetPiece]
+    private let indexById: [String: Int]
+    /// Adjacency masks per edge-contact tolerance (one entry per distinct difficulty tolerance)
+    private let adjacencyByTolerance: [CGFloat: [UInt64]]
+    /// Shared edge length per target pair (row-major, targetIds.count wide) for each tolerance
+    private let sharedEdgesByTolerance: [CGFloat: [CGFloat]]
+
+    /// Bitsets are 64 wide; a tangram puzzle has 7 targets
+    static let maxTargets = 64
+    /// Edge tolerance used when no difficulty is supplied (slightly generous to ensure adjacency is detected)
+    static let defaultEdgeTolerance: CGFloat = 14
+    /// Edges count as shared only when within ~11° of parallel
+    static let parallelCosine: CGFloat = 0.98
+    /// Overlap below this is two edges meeting end to end, not a shared edge
+    static let minSharedEdgeLength: CGFloat = 1
+
+    // MARK: - Compilation
+
+    init(puzzle: GamePuzzleData) {
+        let targets = Array(puzzle.targetPieces.prefix(Self.maxTargets))
+        #if DEBUG
+        if puzzle.targetPieces.count > Self.maxTargets {
+            print("[HintGraph] Puzzle \(puzzle.id) has \(puzzle.targetPieces.count) targets; only the first \(Self.maxTargets) are indexed")
+        }
+        #endif
+
+        // Polygon per target in SK space
+        let polygons: [[CGPoint]] = targets.map { t in
+            let verts = TangramGameGeometry.normalizedVertices(for: t.pieceType)
+            let scaled = TangramGameGeometry.scaleVertices(verts, by: TangramGameConstants.visualScale)
+            let transformed = TangramGameGeometry.transformVertices(scaled, with: t.transform)
+            return transformed.map { TangramPoseMapper.spriteKitPosition(fromRawPosition: $0) }
+        }
+
+        // Distinct tolerances: default plus every difficulty preset
+        var tolerances: Set<CGFloat> = [Self.defaultEdgeTolerance]
+        for difficulty in [UserPreferences.DifficultySetting.easy, .normal, .hard] {
+            tolerances.insert(TangramGameConstants.Validation.tolerances(for: difficulty).edgeContact)
+        }
+
+        var adjacency: [CGFloat: [UInt64]] = [:]
+        var sharedEdges: [CGFloat: [CGFloat]] = [:]
+        let count = targets.count
+        for tolerance in tolerances {
+            var masks = [UInt64](repeating: 0, count: count)
+            var lengths = [CGFloat](repeating: 0, count: count * count)
+            for i in 0..<count {
+                for j in (i + 1)..<count {
+                    let shared = Self.sharedEdgeLength(polygons[i], polygons[j], edgeTolerance: tolerance)
+                    guard shared > 0 else { continue }
+                    masks[i] |= UInt64(1) << UInt64(j)
+                    masks[j] |= UInt64(1) << UInt64(i)
+                    lengths[i * count + j] = shared
+                    lengths[j * count + i] = shared
+                }
+            }
+            adjacency[tolerance] = masks
+            sharedEdges[tolerance] = lengths
+        }
+
+        self.puzzleId = puzzle.id
+        self.targetPieces = targets
+        self.targetIds = targets.map { $0.id }
+        self.pieceTypes = targets.map { $0.pieceType }
+        self.positionsSK = targets.map {
+            TangramPoseMapper.spriteKitPosition(fromRawPosition: TangramPoseMapper.rawPosition(from: $0.transform))
+        }
+        self.polygonsSK = polygons
+        self.indexById = Dictionary(targets.enumerated().map { ($1.id, $0) }, uniquingKeysWith: { first, _ in first })
+        self.adjacencyByTolerance = adjacency
+        self.sharedEdgesByTolerance = sharedEdges
+    }
+
+    /// Whether this graph was compiled from the given puzzle's current targets
+    func matches(_ puzzle: GamePuzzleData) -> Bool {
+        puzzleId == puzzle.id && targetPieces == Array(puzzle.targetPieces.prefix(Self.maxTargets))
+    }
+
+    // MARK: - Lookup
+
+    var allMask: UInt64 {
+        targetIds.count == 64 ? .max : (UInt64(1) << UInt64(targetIds.count)) - 1
+    }
+
+    func index(of targetId: String) -> Int? {
+        indexById[targetId]
+    }
+
+    func mask(for ids: Set<String>) -> UInt64 {
+        var mask: UInt64 = 0
+        for id in ids {
+            if let i = indexById[id] { mask |= UInt64(1) << UInt64(i) }
+        }
+        return mask
+    }
+
+    /// Adjacency masks for a difficulty's edge-contact tolerance
+    func adjacency(for difficulty: UserPreferences.DifficultySetting?) -> [UInt64] {
+        let tolerance = difficulty.map { TangramGameConstants.Validation.tolerances(for: $0).edgeContact } ?? Self.defaultEdgeTolerance
+        return adjacencyByTolerance[tolerance] ?? []
+    }
+
+    /// Length of target i's outline shared with the targets in mask, for a difficulty's edge-contact tolerance
+    func sharedEdgeLength(of i: Int, with mask: UInt64, difficulty: UserPreferences.DifficultySetting?) -> CGFloat {
+        let tolerance = difficulty.map { TangramGameConstants.Validation.tolerances(for: $0).edgeContact } ?? Self.defaultEdgeTolerance
+        guard let lengths = sharedEdgesByTolerance[tolerance], i < targetIds.count else { return 0 }
+        var total: CGFloat = 0
+        var bits = mask & ~(UInt64(1) << UInt64(i))
+        while bits != 0 {
+            let j = bits.trailingZeroBitCount
+            bits &= bits - 1
+            if j < targetIds.count { total += lengths[i * targetIds.count + j] }
+        }
+        return total
+    }
+
+    // MARK: - Bitset Operations
+
+    /// Union of neighbors of every target in mask
+    static func neighbors(of mask: UInt64, adjacency: [UInt64]) -> UInt64 {
+        var result: UInt64 = 0
+        var bits = mask
+        while bits != 0 {
+            let i = bits.trailingZeroBitCount
+            bits &= bits - 1
+            if i < adjacency.count { result |= adjacency[i] }
+        }
+        return result
+    }
+
+    /// Largest connected component of the subgraph induced by mask
+    static func largestComponent(within mask: UInt64, adjacency: [UInt64]) -> UInt64 {
+        var remaining = mask
+        var best: UInt64 = 0
+        while remaining != 0 {
+            var component = UInt64(1) << UInt64(remaining.trailingZeroBitCount)
+            var frontier = component
+            while frontier != 0 {
+                let next = neighbors(of: frontier, adjacency: adjacency) & mask & ~component
+                component |= next
+                frontier = next
+            }
+            remaining &= ~component
+            if component.nonzeroBitCount > best.nonzeroBitCount { best = component }
+        }
+        return best
+    }
+
+    /// Mean SK position of the targets in mask
+    func centroid(of mask: UInt64) -> CGPoint {
+        var sum = CGPoint.zero
+        var count: CGFloat = 0
+        var bits = mask
+        while bits != 0 {
+            let i = bits.trailingZeroBitCount
+            bits &= bits - 1
+            sum.x += positionsSK[i].x; sum.y += positionsSK[i].y; count += 1
+        }
+        if count == 0 { return .zero }
+        return CGPoint(x: sum.x / count, y: sum.y / count)
+    }
+
+    // MARK: - Geometry
+
+    /// Total length along which a's edges lie on b's: pairs of edges within tolerance that run
+    /// (anti)parallel, measured as the overlap of b's edge projected onto a's. Zero when the
+    /// polygons only meet at a corner.
+    static func sharedEdgeLength(_ a: [CGPoint], _ b: [CGPoint], edgeTolerance: CGFloat) -> CGFloat {
+        guard a.count > 1, b.count > 1 else { return 0 }
+        var total: CGFloat = 0
+        for i in 0..<a.count {
+            let a0 = a[i], a1 = a[(i + 1) % a.count]
+            let lengthA = hypot(a1.x - a0.x, a1.y - a0.y)
+            guard lengthA > 0 else { continue }
+            let dir = CGVector(dx: (a1.x - a0.x) / lengthA, dy: (a1.y - a0.y) / lengthA)
+            for j in 0..<b.count {
+                let b0 = b[j], b1 = b[(j + 1) % b.count]
+                guard TangramGeometryUtilities.segmentDistance(a0, a1, b0, b1) <= edgeTolerance else { continue }
+                let lengthB = hypot(b1.x - b0.x, b1.y - b0.y)
+                guard lengthB > 0 else { continue }
+                let cosine = (dir.dx * (b1.x - b0.x) + dir.dy * (b1.y - b0.y)) / lengthB
+                guard abs(cosine) > parallelCosine else { continue }
+                let t0 = (b0.x - a0.x) * dir.dx + (b0.y - a0.y) * dir.dy
+                let t1 = (b1.x - a0.x) * dir.dx + (b1.y - a0.y) * dir.dy
+                let overlap = min(lengthA, max(t0, t1)) - max(0, min(t0, t1))
+                if overlap > minSharedEdgeLength { total += overlap }
+            }
+        }
+        return total
+    }
+}
@@ -0,0 +1,140 @@
+//
+//  TangramSilhouetteCoverage.swift
+//  Bemo
+//
+//  Assignment-free progress score: how much of the silhouette the placed pieces cover
+//
+
+// WHAT: Pre-rasterized target silhouette scored against the union of mapped piece polygons
+// ARCHITECTURE: Model in MVVM-S, built once per puzzle by TangramValidationEngine next to TangramTargetFeatureIndex
+// USAGE: score(polygons:) with SK target-space piece polygons, or piecePolygon(...) to build them from node poses
+
+import Foundation
+import CoreGraphics
+
+/// Per-piece validation needs every piece matched to a specific target; coverage only asks whether the
+/// board looks like the silhouette, so interchangeable pieces and imperfect assignments do not matter.
+struct TangramSilhouetteCoverage {
+
+    // MARK: - Types
+
+    struct Score: Equatable {
+        /// Fraction of silhouette area covered by pieces
+        let coverage: Double
+        /// Piece area outside the silhouette, as a fraction of silhouette area
+        let overflow: Double
+
+        /// Continuous progress in [0, 1]; misplaced area counts against covered area
+        var progress: Double { max(0, min(1, coverage - overflow)) }
+
+        var isComplete: Bool {
+            coverage >= TangramSilhouetteCoverage.completeCoverage && overflow <= TangramSilhouetteCoverage.maxOverflow
+        }
+    }
+
+    // MARK: - Properties
+
+    /// Coverage needed to call the silhouette filled; leaves room for CV jitter along outlines
+    static let completeCoverage = 0.93
+    /// Tolerated spill outside the silhouette when complete
+    static let maxOverflow = 0.07
+    /// Mask side length in pixels; 64×64 keeps a frame's scoring well under a millisecond
+    static let defaultResolution = 64
+
+    let puzzleId: String
+    private let targetPieces: [GamePuzzleData.TargetPiece]
+    private let targetPolygons: [[CGPoint]]
+    private let resolution: Int
+    /// SK target space → mask pixels, framing the silhouette with margin so overflow stays visible
+    private let frame: CGAffineTransform
+    /// SK target-space region inside the mask under `frame`; pieces beyond it need a wider frame
+    private let framedBounds: CGRect
+    private let targetMask: TangramCoverageMask
+    private let targetArea: Double
+
+    // MARK: - Initialization
+
+    init(puzzle: GamePuzzleData, resolution: Int = TangramSilhouetteCoverage.defaultResolution) {
+        let polygons = puzzle.targetPieces.map { TangramBounds.computeSKTransformedVertices(for: $0) }
+        let size = CGSize(width: resolution, height: resolution)
+
+        self.puzzleId = puzzle.id
+        self.targetPieces = puzzle.targetPieces
+        self.targetPolygons = polygons
+        self.resolution = resolution
+        self.frame = TangramSilhouetteRasterizer.fitTransform(
+            bounds: TangramSilhouetteRasterizer.bounds(of: polygons),
+            into: size,
+            fill: 0.7
+        )
+        self.framedBounds = CGRect(origin: .zero, size: size).applying(frame.inverted())
+        self.targetMask = TangramSilhouetteRasterizer.rasterize(polygons, width: resolution, height: resolution, transform: frame)
+        self.targetArea = targetMask.area
+    }
+
+    func matches(_ puzzle: GamePuzzleData) -> Bool {
+        puzzleId == puzzle.id && targetPieces == puzzle.targetPieces
+    }
+
+    // MARK: - Scoring
+
+    /// Score the union of piece polygons given in SK target space. Pieces inside the cached frame
+    /// reuse the pre-rasterized silhouette; otherwise both are re-framed around their union, since
+    /// the rasterizer clamps anything outside the mask onto its border and overflow would be lost.
+    func score(polygons: [[CGPoint]]) -> Score {
+        guard targetArea > 0 else { return Score(coverage: 0, overflow: 0) }
+        let pieceBounds = TangramSilhouetteRasterizer.bounds(of: polygons)
+        if pieceBounds.isNull || framedBounds.contains(pieceBounds) {
+            let placed = TangramSilhouetteRasterizer.rasterize(polygons, width: resolution, height: resolution, transform: frame)
+            return Self.score(placed: placed, target: targetMask, targetArea: targetArea)
+        }
+
+        let union = TangramSilhouetteRasterizer.bounds(of: targetPolygons).union(pieceBounds)
+        let wide = TangramSilhouetteRasterizer.fitTransform(
+            bounds: union,
+            into: CGSize(width: resolution, height: resolution),
+            fill: 0.9
+        )
+        let target = TangramSilhouetteRasterizer.rasterize(targetPolygons, width: resolution, height: resolution, transform: wide)
+        let placed = TangramSilhouetteRasterizer.rasterize(polygons, width: resolution, height: resolution, transform: wide)
+        return Self.score(placed: placed, target: target, targetArea: target.area)
+    }
+
+    private static func score(placed: TangramCoverageMask, target: TangramCoverageMask, targetArea: Double) -> Score {
+        guard targetArea > 0 else { return Score(coverage: 0, overflow: 0) }
+        var covered = 0.0
+        var spilled = 0.0
+        for i in placed.values.indices {
+            let piece = Double(placed.values[i])
+            let mask = Double(target.values[i])
+            covered += min(piece, mask)
+            spilled += max(0, piece - mask)
+        }
+        return Score(coverage: covered / targetArea, overflow: spilled / targetArea)
+    }
+
+    // MARK: - Piece Geometry
+
+    /// World polygon of a piece node posed at `position` (its vertex centroid) with `rotation`,
+    /// matching how PuzzlePieceNode centers and flips its shape
+    static func piecePolygon(
+        pieceType: TangramPieceType,
+        position: CGPoint,
+        rotation: CGFloat,
+        isFlipped: Bool
+    ) -> [CGPoint] {
+        var local = TangramGameGeometry.scaleVertices(
+            TangramGameGeometry.normalizedVertices(for: pieceType),
+            by: TangramGameConstants.visualScale
+        )
+        if isFlipped {
+            local = local.map { CGPoint(x: -$0.x, y: $0.y) }
+        }
+        let center = TangramGameGeometry.centerOfVertices(local)
+        let c = cos(rotation), s = sin(rotation)
+        return local.map { vertex in
+            let x = vertex.x - center.x, y = vertex.y - center.y
+            return CGPoint(x: position.x + x * c - y * s, y: position.y + x * s + y * c)
+        }
+    }
+}
@@ -0,0 +1,128 @@
+//
+//  TangramSilhouetteDescriptor.swift
+//  Bemo
+//
+//  Rotation-, flip- and scale-invariant shape signature of a puzzle silhouette
+//
+
+// WHAT: Log-scaled Hu moment invariants of the union of a puzzle's target polygons
+// ARCHITECTURE: Model in MVVM-S, built per puzzle and stored in TangramSilhouetteIndex
+// USAGE: TangramSilhouetteDescriptor(puzzle:) then distance(to:) for similarity
+
+import Foundation
+import CoreGraphics
+
+/// Hu moments are computed exactly from polygon outlines (Green's theorem), so no rasterization is needed.
+/// Targets do not overlap in a valid puzzle, which makes silhouette moments the sum of per-piece moments.
+struct TangramSilhouetteDescriptor: Equatable {
+
+    // MARK: - Properties
+
+    /// Seven log-scaled Hu invariants; the seventh uses its magnitude so mirror images match
+    let values: [Double]
+
+    /// Invariants below this magnitude are treated as noise by the log map
+    private static let invariantFloor = 1e-12
+
+    // MARK: - Initialization
+
+    init(puzzle: GamePuzzleData) {
+        self.init(polygons: puzzle.targetPieces.map { TangramBounds.computeSKTransformedVertices(for: $0) })
+    }
+
+    init(polygons: [[CGPoint]]) {
+        var m = RawMoments()
+        for polygon in polygons {
+            m.add(polygon: polygon)
+        }
+        self.values = Self.huInvariants(from: m)
+    }
+
+    // MARK: - Comparison
+
+    /// Euclidean distance in log-Hu space; 0 for congruent or mirrored silhouettes
+    func distance(to other: TangramSilhouetteDescriptor) -> Double {
+        var sum = 0.0
+        for (a, b) in zip(values, other.values) {
+            sum += (a - b) * (a - b)
+        }
+        return sum.squareRoot()
+    }
+
+    // MARK: - Moments
+
+    private struct RawMoments {
+        var m00 = 0.0, m10 = 0.0, m01 = 0.0
+        var m20 = 0.0, m11 = 0.0, m02 = 0.0
+        var m30 = 0.0, m21 = 0.0, m12 = 0.0, m03 = 0.0
+
+        /// Accumulate exact area moments up to order 3 for one simple polygon (either winding)
+        mutating func add(polygon: [CGPoint]) {
+            guard polygon.count > 2 else { return }
+            var p = RawMoments()
+            for i in 0..<polygon.count {
+                let x0 = Double(polygon[i].x), y0 = Double(polygon[i].y)
+                let x1 = Double(polygon[(i + 1) % polygon.count].x), y1 = Double(polygon[(i + 1) % polygon.count].y)
+                let c = x0 * y1 - x1 * y0
+                p.m00 += c
+                p.m10 += c * (x0 + x1)
+                p.m01 += c * (y0 + y1)
+                p.m20 += c * (x0 * x0 + x0 * x1 + x1 * x1)
+                p.m02 += c * (y0 * y0 + y0 * y1 + y1 * y1)
+                p.m11 += c * (x0 * y1 + 2 * x0 * y0 + 2 * x1 * y1 + x1 * y0)
+                p.m30 += c * (x0 * x0 * x0 + x0 * x0 * x1 + x0 * x1 * x1 + x1 * x1 * x1)
+                p.m03 += c * (y0 * y0 * y0 + y0 * y0 * y1 + y0 * y1 * y1 + y1 * y1 * y1)
+                p.m21 += c * (x0 * x0 * (3 * y0 + y1) + 2 * x0 * x1 * (y0 + y1) + x1 * x1 * (y0 + 3 * y1))
+                p.m12 += c * (y0 * y0 * (3 * x0 + x1) + 2 * y0 * y1 * (x0 + x1) + y1 * y1 * (x0 + 3 * x1))
+            }
+            // Clockwise outlines produce negated sums
+            let sign: Double = p.m00 < 0 ? -1 : 1
+            m00 += sign * p.m00 / 2
+            m10 += sign * p.m10 / 6
+            m01 += sign * p.m01 / 6
+            m20 += sign * p.m20 / 12
+            m02 += sign * p.m02 / 12
+            m11 += sign * p.m11 / 24
+            m30 += sign * p.m30 / 20
+            m03 += sign * p.m03 / 20
+            m21 += sign * p.m21 / 60
+            m12 += sign * p.m12 / 60
+        }
+    }
+
+    private static func huInvariants(from m: RawMoments) -> [Double] {
+        guard m.m00 > 0 else { return [Double](repeating: 0, count: 7) }
+        let xc = m.m10 / m.m00, yc = m.m01 / m.m00
+
+        // Central moments
+        let mu20 = m.m20 - xc * m.m10
+        let mu02 = m.m02 - yc * m.m01
+        let mu11 = m.m11 - xc * m.m01
+        let mu30 = m.m30 - 3 * xc * m.m20 + 2 * xc * xc * m.m10
+        let mu03 = m.m03 - 3 * yc * m.m02 + 2 * yc * yc * m.m01
+        let mu21 = m.m21 - 2 * xc * m.m11 - yc * m.m20 + 2 * xc * xc * m.m01
+        let mu12 = m.m12 - 2 * yc * m.m11 - xc * m.m02 + 2 * yc * yc * m.m10
+
+        // Scale-normalized moments
+        let s2 = pow(m.m00, 2), s3 = pow(m.m00, 2.5)
+        let n20 = mu20 / s2, n02 = mu02 / s2, n11 = mu11 / s2
+        let n30 = mu30 / s3, n03 = mu03 / s3, n21 = mu21 / s3, n12 = mu12 / s3
+
+        let a = n30 + n12, b = n21 + n03
+        let h1 = n20 + n02
+        let h2 = (n20 - n02) * (n20 - n02) + 4 * n11 * n11
+        let h3 = (n30 - 3 * n12) * (n30 - 3 * n12) + (3 * n21 - n03) * (3 * n21 - n03)
+        let h4 = a * a + b * b
+        let h5 = (n30 - 3 * n12) * a * (a * a - 3 * b * b) + (3 * n21 - n03) * b * (3 * a * a - b * b)
+        let h6 = (n20 - n02) * (a * a - b * b) + 4 * n11 * a * b
+        let h7 = (3 * n21 - n03) * a * (a * a - 3 * b * b) - (n30 - 3 * n12) * b * (3 * a * a - b * b)
+
+        // Signed log scale so all invariants contribute comparably; log1p keeps the map continuous
+        // through 0, where float noise on symmetric silhouettes would otherwise dominate.
+        // h7 changes sign under reflection, so only its magnitude is kept.
+        return [h1, h2, h3, h4, h5, h6, abs(h7)].map { h in
+            let scaled = log10(1 + abs(h) / Self.invariantFloor)
+            return h < 0 ? -scaled : scaled
+        }
+    }
+}
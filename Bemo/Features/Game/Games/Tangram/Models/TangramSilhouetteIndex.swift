@@ -0,0 +1,82 @@
+//
+//  TangramSilhouetteIndex.swift
+//  Bemo
+//
+//  In-memory similarity index over puzzle silhouette descriptors
+//
+
+// WHAT: Nearest-neighbour and near-duplicate queries over TangramSilhouetteDescriptor for a puzzle library
+// ARCHITECTURE: Model in MVVM-S, built lazily and cached by PuzzleLibraryService
+// USAGE: TangramSilhouetteIndex(puzzles:), then similar(to:limit:) or nearDuplicates(maxDistance:)
+
+import Foundation
+
+/// Descriptors are 7 doubles, so an exact linear scan over a few thousand puzzles is
+/// already sub-millisecond; a contiguous array keeps it cache friendly without an ANN structure.
+struct TangramSilhouetteIndex {
+
+    // MARK: - Types
+
+    struct Match: Equatable {
+        let puzzleId: String
+        let distance: Double
+    }
+
+    // MARK: - Properties
+
+    /// Distance below which two silhouettes are treated as the same shape
+    static let duplicateDistance = 0.05
+
+    private let puzzleIds: [String]
+    private let descriptors: [TangramSilhouetteDescriptor]
+    private let rowById: [String: Int]
+
+    var count: Int { puzzleIds.count }
+
+    // MARK: - Initialization
+
+    init(puzzles: [GamePuzzleData]) {
+        let indexed = puzzles.filter { !$0.targetPieces.isEmpty }
+        self.puzzleIds = indexed.map { $0.id }
+        self.descriptors = indexed.map { TangramSilhouetteDescriptor(puzzle: $0) }
+        self.rowById = Dictionary(indexed.enumerated().map { ($1.id, $0) }, uniquingKeysWith: { first, _ in first })
+    }
+
+    // MARK: - Queries
+
+    func descriptor(for puzzleId: String) -> TangramSilhouetteDescriptor? {
+        rowById[puzzleId].map { descriptors[$0] }
+    }
+
+    /// Closest puzzles to the given descriptor, nearest first
+    func nearest(to descriptor: TangramSilhouetteDescriptor, limit: Int, excluding excludedId: String? = nil) -> [Match] {
+        guard limit > 0 else { return [] }
+        var best: [Match] = []
+        best.reserveCapacity(limit + 1)
+        for row in descriptors.indices where puzzleIds[row] != excludedId {
+            let d = descriptor.distance(to: descriptors[row])
+            if best.count == limit, let worst = best.last, d >= worst.distance { continue }
+            let position = best.firstIndex { $0.distance > d } ?? best.count
+            best.insert(Match(puzzleId: puzzleIds[row], distance: d), at: position)
+            if best.count > limit { best.removeLast() }
+        }
+        return best
+    }
+
+    /// "More puzzles like this one"
+    func similar(to puzzleId: String, limit: Int) -> [Match] {
+        guard let descriptor = descriptor(for: puzzleId) else { return [] }
+        return nearest(to: descriptor, limit: limit, excluding: puzzleId)
+    }
+
+    /// Pairs of puzzles whose silhouettes match up to rotation, reflection and scale
+    func nearDuplicates(maxDistance: Double = TangramSilhouetteIndex.duplicateDistance) -> [(String, String)] {
+        var pairs: [(String, String)] = []
+        for i in descriptors.indices {
+            for j in (i + 1)..<descriptors.count where descriptors[i].distance(to: descriptors[j]) <= maxDistance {
+                pairs.append((puzzleIds[i], puzzleIds[j]))
+            }
+        }
+        return pairs
+    }
+}
@@ -0,0 +1,110 @@
+//
+//  TangramTargetFeatureIndex.swift
+//  Bemo
+//
+//  Per-puzzle table of precomputed target features for per-frame validation
+//
+
+// WHAT: Caches SK-space centroids, feature angles, flip state and symmetry period for every target
+// ARCHITECTURE: Model in MVVM-S, built once per puzzle by TangramValidationEngine
+// USAGE: Build with init(puzzle:), then look up entries by id or candidates by piece type
+
+import Foundation
+import CoreGraphics
+
+/// Immutable per-puzzle lookup table so the CV frame path never re-derives target geometry
+struct TangramTargetFeatureIndex {
+
+    // MARK: - Types
+
+    struct Entry {
+        let target: GamePuzzleData.TargetPiece
+        /// Target centroid in SpriteKit space
+        let centroidSK: CGPoint
+        /// Target feature angle in SpriteKit space (zRotation + canonical target feature)
+        let featureAngle: CGFloat
+        /// Whether the target transform is mirrored (negative determinant)
+        let isFlipped: Bool
+        /// Rotation period after symmetry reduction (2π / rotational fold)
+        let symmetryPeriod: CGFloat
+
+        var id: String { target.id }
+        var pieceType: TangramPieceType { target.pieceType }
+    }
+
+    // MARK: - Properties
+
+    let puzzleId: String
+    private let targetPieces: [GamePuzzleData.TargetPiece]
+    private let entriesById: [String: Entry]
+    private let entriesByType: [TangramPieceType: [Entry]]
+
+    // MARK: - Initialization
+
+    init(puzzle: GamePuzzleData) {
+        var byId: [String: Entry] = [:]
+        var byType: [TangramPieceType: [Entry]] = [:]
+
+        for target in puzzle.targetPieces {
+            let vertices = TangramBounds.computeSKTransformedVertices(for: target)
+            let rawAngle = TangramPoseMapper.rawAngle(from: target.transform)
+            let rotationSK = TangramPoseMapper.spriteKitAngle(fromRawAngle: rawAngle)
+            let canonicalTarget: CGFloat = target.pieceType.isTriangle ? (.pi / 4) : 0
+            let determinant = target.transform.a * target.transform.d - target.transform.b * target.transform.c
+            // Flip state does not change fold for any tangram piece
+            let fold = TangramRotationValidator.rotationalSymmetryFold(for: target.pieceType, isFlipped: false)
+
+            let entry = Entry(
+                target: target,
+                centroidSK: TangramGameGeometry.centerOfVertices(vertices),
+                featureAngle: TangramRotationValidator.normalizeAngle(rotationSK + canonicalTarget),
+                isFlipped: determinant < 0,
+                symmetryPeriod: (2 * .pi) / CGFloat(fold)
+            )
+            byId[target.id] = entry
+            byType[target.pieceType, default: []].append(entry)
+        }
+
+        self.puzzleId = puzzle.id
+        self.targetPieces = puzzle.targetPieces
+        self.entriesById = byId
+        self.entriesByType = byType
+    }
+
+    // MARK: - Lookup
+
+    /// Whether this table was built from the given puzzle's current targets
+    func matches(_ puzzle: GamePuzzleData) -> Bool {
+        puzzleId == puzzle.id && targetPieces == puzzle.targetPieces
+    }
+
+    func entry(for targetId: String) -> Entry? {
+        entriesById[targetId]
+    }
+
+    func candidates(for pieceType: TangramPieceType) -> [Entry] {
+        entriesByType[pieceType] ?? []
+    }
+
+    // MARK: - Canonical Comparison
+
+    /// Signed rotation difference from a piece feature angle to the nearest symmetric
+    /// equivalent of the target feature angle, in [-period/2, period/2].
+    /// Equivalent to TangramRotationValidator.rotationDifferenceToNearest without the per-fold loop.
+    static func symmetricDelta(pieceFeature: CGFloat, entry: Entry) -> CGFloat {
+        let period = entry.symmetryPeriod
+        var diff = (pieceFeature - entry.featureAngle).truncatingRemainder(dividingBy: period)
+        if diff > period / 2 {
+            diff -= period
+        } else if diff < -period / 2 {
+            diff += period
+        }
+        return diff
+    }
+
+    /// Piece feature angle for an observed SK zRotation (mirrors the target-side canonical offset)
+    static func pieceFeatureAngle(rotation: CGFloat, isFlipped: Bool, pieceType: TangramPieceType) -> CGFloat {
+        let canonicalPiece: CGFloat = pieceType.isTriangle ? (3 * .pi / 4) : 0
+        return TangramRotationValidator.normalizeAngle(rotation + (isFlipped ? -canonicalPiece : canonicalPiece))
+    }
+}
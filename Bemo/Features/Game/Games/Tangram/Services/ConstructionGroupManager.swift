@@ -55,6 +55,46 @@ class ConstructionGroupManager {
         
         // Minimum pieces for validation
         static let minPiecesForValidation: Int = 2
+        
+        // Broadphase grid cell size (~large triangle extent plus contact tolerance)
+        static let broadphaseCellSize: CGFloat = 160
+    }
+    
+    // MARK: - Geometry Cache Types
+    
+    /// World-space polygon and padded bounds for a piece at a specific pose
+    private struct PieceGeometry {
+        let position: CGPoint
+        let rotation: CGFloat
+        let isFlipped: Bool
+        let vertices: [CGPoint]
+        /// Polygon bounds padded by the contact tolerance, unioned with the centroid-proximity square
+        let broadphaseBounds: CGRect
+        
+        func matches(_ node: PuzzlePieceNode) -> Bool {
+            position == node.position && hasSameOrientation(as: node)
+        }
+        
+        func hasSameOrientation(as node: PuzzlePieceNode) -> Bool {
+            rotation == node.zRotation && isFlipped == node.isFlipped
+        }
+        
+        /// Closed overlap test: bounds that only share an edge still count, since padding puts
+        /// pieces exactly at the contact tolerance on that edge
+        func broadphaseOverlaps(_ other: PieceGeometry) -> Bool {
+            broadphaseBounds.minX <= other.broadphaseBounds.maxX && other.broadphaseBounds.minX <= broadphaseBounds.maxX &&
+            broadphaseBounds.minY <= other.broadphaseBounds.maxY && other.broadphaseBounds.minY <= broadphaseBounds.maxY
+        }
+    }
+    
+    /// Unordered piece pair key
+    private struct PiecePair: Hashable {
+        let first: String
+        let second: String
+        
+        init(_ a: String, _ b: String) {
+            if a < b { first = a; second = b } else { first = b; second = a }
+        }
     }
     
     // MARK: - Properties
@@ -65,6 +105,10 @@ class ConstructionGroupManager {
     private var lastGroupCentroid: [UUID: (pos: CGPoint, t: TimeInterval)] = [:]
     private var groupDwellStart: [UUID: TimeInterval] = [:]
     private var groupValidationGate: [UUID: Bool] = [:]
+    // Geometry and pair contacts are only recomputed for pieces whose pose changed
+    private var pieceGeometry: [String: PieceGeometry] = [:]
+    private var pairContacts: [PiecePair: Bool] = [:] // polygon distance within edge tolerance
+    private var pairAlignment: [PiecePair: Float] = [:] // rotation agreement; only turning a piece invalidates it
     
     // MARK: - Public Interface
     
@@ -73,8 +117,10 @@ class ConstructionGroupManager {
         // Remove stale groups
         cleanStaleGroups()
         
-        // Build proximity map
+        // Refresh cached geometry for moved pieces, then build proximity map (grid broadphase)
+        refreshGeometry(for: pieces)
         let proximityMap = buildProximityMap(pieces)
+        let clusters = connectedComponents(in: proximityMap)
         
         // Form or update groups
         var updatedGroups: [UUID: ConstructionGroup] = [:]
@@ -92,8 +138,8 @@ class ConstructionGroupManager {
                 removePieceFromGroups(pieceId)
             } else {
                 // Find or create group for this cluster
-                let cluster = findCluster(starting: pieceId, in: proximityMap)
-                let group = findOrCreateGroup(for: cluster, pieces: pieces)
+                let cluster = clusters[pieceId] ?? [pieceId]
+                let group = findOrCreateGroup(for: cluster)
                 updatedGroups[group.id] = group
                 assignedPieces.formUnion(cluster)
             }
@@ -105,7 +151,7 @@ class ConstructionGroupManager {
         for id in groups.keys {
             groups[id]?.updateState()
             if let group = groups[id] {
-                groups[id]?.confidence = calculateConfidence(for: group, pieces: pieces)
+                groups[id]?.confidence = calculateConfidence(for: group)
                 // Update validation intent gate (relocating vs constructing with dwell)
                 groupValidationGate[id] = computeValidationGate(for: group, pieces: pieces)
             }
@@ -122,11 +168,11 @@ class ConstructionGroupManager {
     }
     
     /// Calculate confidence score for a group
-    func calculateConfidence(for group: ConstructionGroup, pieces: [PuzzlePieceNode]) -> Float {
+    func calculateConfidence(for group: ConstructionGroup) -> Float {
         guard group.pieces.count >= Config.minPiecesForValidation else { return 0 }
         
         // Get spatial signals
-        let spatial = calculateSpatialSignals(for: group, pieces: pieces)
+        let spatial = calculateSpatialSignals(for: group)
         
         // Get temporal signals
         let temporal = calculateTemporalSignals(for: group)
@@ -251,34 +297,165 @@ class ConstructionGroupManager {
         }
     }
     
+    /// Recompute world polygons only for pieces that are new or whose pose changed,
+    /// invalidating cached pair contacts (and, for turned pieces, alignments) that involve them
+    private func refreshGeometry(for pieces: [PuzzlePieceNode]) {
+        var changed: Set<String> = []
+        var turned: Set<String> = []
+        var present: Set<String> = []
+        
+        for piece in pieces {
+            guard let id = piece.name else { continue }
+            present.insert(id)
+            let cached = pieceGeometry[id]
+            if let cached, cached.matches(piece) { continue }
+            if cached?.hasSameOrientation(as: piece) != true { turned.insert(id) }
+            pieceGeometry[id] = makeGeometry(for: piece)
+            changed.insert(id)
+        }
+        
+        // Drop pieces that left the scene
+        for id in pieceGeometry.keys where !present.contains(id) {
+            pieceGeometry.removeValue(forKey: id)
+            changed.insert(id)
+            turned.insert(id)
+        }
+        
+        if !changed.isEmpty {
+            pairContacts = pairContacts.filter { pair, _ in
+                !changed.contains(pair.first) && !changed.contains(pair.second)
+            }
+        }
+        if !turned.isEmpty {
+            pairAlignment = pairAlignment.filter { pair, _ in
+                !turned.contains(pair.first) && !turned.contains(pair.second)
+            }
+        }
+    }
+    
+    private func makeGeometry(for piece: PuzzlePieceNode) -> PieceGeometry {
+        let vertices = transformedVertices(for: piece)
+        var bounds = CGRect(
+            x: piece.position.x - Config.proximityThreshold / 2,
+            y: piece.position.y - Config.proximityThreshold / 2,
+            width: Config.proximityThreshold,
+            height: Config.proximityThreshold
+        )
+        if let first = vertices.first {
+            var minX = first.x, maxX = first.x, minY = first.y, maxY = first.y
+            for v in vertices {
+                minX = min(minX, v.x); maxX = max(maxX, v.x)
+                minY = min(minY, v.y); maxY = max(maxY, v.y)
+            }
+            let pad = Config.edgeAdjacencyTolerance / 2
+            bounds = bounds.union(CGRect(
+                x: minX - pad,
+                y: minY - pad,
+                width: maxX - minX + 2 * pad,
+                height: maxY - minY + 2 * pad
+            ))
+        }
+        return PieceGeometry(
+            position: piece.position,
+            rotation: piece.zRotation,
+            isFlipped: piece.isFlipped,
+            vertices: vertices,
+            broadphaseBounds: bounds
+        )
+    }
+    
     private func buildProximityMap(_ pieces: [PuzzlePieceNode]) -> [String: Set<String>] {
         var proximityMap: [String: Set<String>] = [:]
         
-        for i in 0..<pieces.count {
-            guard let id1 = pieces[i].name else { continue }
-            proximityMap[id1] = []
-            
-            for j in (i+1)..<pieces.count {
-                guard let id2 = pieces[j].name else { continue }
-                
-                // Centroid distance fallback
-                let centerDistance = hypot(
-                    pieces[i].position.x - pieces[j].position.x,
-                    pieces[i].position.y - pieces[j].position.y
-                )
-                
-                // Polygon edge/vertex adjacency detection (physical realism: touching pieces are connected)
-                let polyDistance = minimumPolygonDistance(between: pieces[i], and: pieces[j])
-                
-                if centerDistance < Config.proximityThreshold || polyDistance <= Config.edgeAdjacencyTolerance {
-                    proximityMap[id1]?.insert(id2)
-                    proximityMap[id2, default: []].insert(id1)
+        // Uniform grid broadphase: only pieces sharing a cell are tested
+        struct Cell: Hashable { let x: Int; let y: Int }
+        var grid: [Cell: [String]] = [:]
+        for piece in pieces {
+            guard let id = piece.name, let geometry = pieceGeometry[id] else { continue }
+            proximityMap[id] = []
+            let b = geometry.broadphaseBounds
+            let minCX = Int((b.minX / Config.broadphaseCellSize).rounded(.down))
+            let maxCX = Int((b.maxX / Config.broadphaseCellSize).rounded(.down))
+            let minCY = Int((b.minY / Config.broadphaseCellSize).rounded(.down))
+            let maxCY = Int((b.maxY / Config.broadphaseCellSize).rounded(.down))
+            for cx in minCX...maxCX {
+                for cy in minCY...maxCY {
+                    grid[Cell(x: cx, y: cy), default: []].append(id)
+                }
+            }
+        }
+        
+        var tested: Set<PiecePair> = []
+        for ids in grid.values where ids.count > 1 {
+            for i in 0..<(ids.count - 1) {
+                for j in (i + 1)..<ids.count {
+                    let pair = PiecePair(ids[i], ids[j])
+                    guard tested.insert(pair).inserted,
+                          let g1 = pieceGeometry[pair.first],
+                          let g2 = pieceGeometry[pair.second],
+                          g1.broadphaseOverlaps(g2) else { continue }
+                    
+                    // Centroid distance fallback
+                    let centerDistance = hypot(g1.position.x - g2.position.x, g1.position.y - g2.position.y)
+                    
+                    // Polygon edge/vertex adjacency detection (physical realism: touching pieces are connected)
+                    let inContact = contact(for: pair, g1, g2)
+                    
+                    if centerDistance < Config.proximityThreshold || inContact {
+                        proximityMap[pair.first, default: []].insert(pair.second)
+                        proximityMap[pair.second, default: []].insert(pair.first)
+                    }
                 }
             }
         }
         
         return proximityMap
     }
+    
+    /// Cached polygon contact for a pair; narrowphase runs only when either pose changed
+    private func contact(for pair: PiecePair, _ g1: PieceGeometry, _ g2: PieceGeometry) -> Bool {
+        if let cached = pairContacts[pair] { return cached }
+        let inContact = TangramGeometryUtilities.minimumDistanceBetweenPolygons(g1.vertices, g2.vertices) <= Config.edgeAdjacencyTolerance
+        pairContacts[pair] = inContact
+        return inContact
+    }
+    
+    /// Connected components over the proximity map via union-find
+    /// - Returns: Cluster membership for every piece with at least one neighbor
+    private func connectedComponents(in proximityMap: [String: Set<String>]) -> [String: Set<String>] {
+        var parent: [String: String] = [:]
+        func find(_ x: String) -> String {
+            var root = x
+            while let p = parent[root], p != root { root = p }
+            // Path compression
+            var node = x
+            while let p = parent[node], p != root {
+                parent[node] = root
+                node = p
+            }
+            return root
+        }
+        
+        for (id, neighbors) in proximityMap where !neighbors.isEmpty {
+            if parent[id] == nil { parent[id] = id }
+            for neighbor in neighbors {
+                if parent[neighbor] == nil { parent[neighbor] = neighbor }
+                let ra = find(id)
+                let rb = find(neighbor)
+                if ra != rb { parent[rb] = ra }
+            }
+        }
+        
+        var components: [String: Set<String>] = [:]
+        for id in parent.keys {
+            components[find(id), default: []].insert(id)
+        }
+        var membership: [String: Set<String>] = [:]
+        for members in components.values {
+            for id in members { membership[id] = members }
+        }
+        return membership
+    }
 
     // MARK: - Intent Gating (no zones)
     private func computeValidationGate(for group: ConstructionGroup, pieces: [PuzzlePieceNode]) -> Bool {
@@ -337,12 +514,12 @@ class ConstructionGroupManager {
     }
 
     private func countEdgeContacts(for group: ConstructionGroup, pieces: [PuzzlePieceNode]) -> Int {
-        let nodes = pieces.filter { node in group.pieces.contains(node.name ?? "") }
+        // Contacts were resolved during the proximity pass; pairs never tested are not touching
+        let ids = group.pieces.sorted()
         var count = 0
-        for i in 0..<nodes.count {
-            for j in (i+1)..<nodes.count {
-                let d = minimumPolygonDistance(between: nodes[i], and: nodes[j])
-                if d <= Config.edgeAdjacencyTolerance { count += 1 }
+        for i in 0..<ids.count {
+            for j in (i+1)..<ids.count where pairContacts[PiecePair(ids[i], ids[j])] == true {
+                count += 1
             }
         }
         return count
@@ -374,94 +551,23 @@ class ConstructionGroupManager {
     // Compute minimum distance between two piece polygons in the current coordinate space
     // Expose for validator usage
     func minimumPolygonDistance(between a: PuzzlePieceNode, and b: PuzzlePieceNode) -> CGFloat {
-        func transformedVertices(for piece: PuzzlePieceNode) -> [CGPoint] {
-            guard let type = piece.pieceType else { return [] }
-            // 1) Base vertices in local piece space
-            let base = TangramGameGeometry.scaleVertices(
-                TangramGameGeometry.normalizedVertices(for: type),
-                by: TangramGameConstants.visualScale
-            )
-            // 2) Apply flip
-            let flipped: [CGPoint]
-            if piece.isFlipped {
-                flipped = base.map { CGPoint(x: -$0.x, y: $0.y) }
-            } else {
-                flipped = base
-            }
-            // 3) Apply rotation around origin (piece path is centered at 0,0)
-            let cosA = cos(piece.zRotation)
-            let sinA = sin(piece.zRotation)
-            let rotated = flipped.map { v in CGPoint(x: v.x * cosA - v.y * sinA, y: v.x * sinA + v.y * cosA) }
-            // 4) Translate to piece.position
-            let translated = rotated.map { CGPoint(x: $0.x + piece.position.x, y: $0.y + piece.position.y) }
-            return translated
-        }
-        func edges(_ poly: [CGPoint]) -> [(CGPoint, CGPoint)] {
-            guard poly.count >= 2 else { return [] }
-            return (0..<poly.count).map { i in (poly[i], poly[(i+1) % poly.count]) }
-        }
-        func segmentDistance(_ p1: CGPoint, _ p2: CGPoint, _ p3: CGPoint, _ p4: CGPoint) -> CGFloat {
-            // Standard segment-segment distance
-            let u = CGVector(dx: p2.x - p1.x, dy: p2.y - p1.y)
-            let v = CGVector(dx: p4.x - p3.x, dy: p4.y - p3.y)
-            let w = CGVector(dx: p1.x - p3.x, dy: p1.y - p3.y)
-            let a = u.dx*u.dx + u.dy*u.dy
-            let b = u.dx*v.dx + u.dy*v.dy
-            let c = v.dx*v.dx + v.dy*v.dy
-            let d = u.dx*w.dx + u.dy*w.dy
-            let e = v.dx*w.dx + v.dy*w.dy
-            let denom = a*c - b*b
-            var sc: CGFloat = 0
-            var tc: CGFloat = 0
-            func clamp(_ x: CGFloat, _ lo: CGFloat, _ hi: CGFloat) -> CGFloat { max(lo, min(hi, x)) }
-            if denom < 1e-6 {
-                sc = 0
-                tc = clamp(e/c, 0, 1)
-            } else {
-                sc = clamp((b*e - c*d)/denom, 0, 1)
-                tc = clamp((a*e - b*d)/denom, 0, 1)
-            }
-            let dpx = w.dx + sc*u.dx - tc*v.dx
-            let dpy = w.dy + sc*u.dy - tc*v.dy
-            return hypot(dpx, dpy)
-        }
         let pa = transformedVertices(for: a)
         let pb = transformedVertices(for: b)
         if pa.isEmpty || pb.isEmpty { return .greatestFiniteMagnitude }
-        let ea = edges(pa)
-        let eb = edges(pb)
-        var minDist: CGFloat = .greatestFiniteMagnitude
-        for (a0, a1) in ea {
-            for (b0, b1) in eb {
-                let d = segmentDistance(a0, a1, b0, b1)
-                if d < minDist { minDist = d }
-                if minDist == 0 { return 0 }
-            }
-        }
-        return minDist
+        return TangramGeometryUtilities.minimumDistanceBetweenPolygons(pa, pb)
     }
     
-    private func findCluster(starting: String, in proximityMap: [String: Set<String>]) -> Set<String> {
-        var cluster: Set<String> = [starting]
-        var toProcess: Set<String> = proximityMap[starting] ?? []
-        
-        while !toProcess.isEmpty {
-            let current = toProcess.removeFirst()
-            cluster.insert(current)
-            
-            if let neighbors = proximityMap[current] {
-                for neighbor in neighbors {
-                    if !cluster.contains(neighbor) {
-                        toProcess.insert(neighbor)
-                    }
-                }
-            }
-        }
-        
-        return cluster
+    private func transformedVertices(for piece: PuzzlePieceNode) -> [CGPoint] {
+        guard let type = piece.pieceType else { return [] }
+        return TangramGeometryUtilities.transformedVertices(
+            for: type,
+            isFlipped: piece.isFlipped,
+            zRotation: piece.zRotation,
+            translation: piece.position
+        )
     }
     
-    private func findOrCreateGroup(for cluster: Set<String>, pieces: [PuzzlePieceNode]) -> ConstructionGroup {
+    private func findOrCreateGroup(for cluster: Set<String>) -> ConstructionGroup {
         // Check if any piece in cluster belongs to existing group
         for (_, group) in groups {
             if !group.pieces.isDisjoint(with: cluster) {
@@ -475,8 +581,8 @@ class ConstructionGroupManager {
                 }
                 
                 // Calculate center of mass
-                updated.centerOfMass = calculateCenterOfMass(for: cluster, pieces: pieces)
-                updated.boundingRadius = calculateBoundingRadius(for: cluster, pieces: pieces, center: updated.centerOfMass)
+                updated.centerOfMass = calculateCenterOfMass(for: cluster)
+                updated.boundingRadius = calculateBoundingRadius(for: cluster, center: updated.centerOfMass)
                 
                 return updated
             }
@@ -486,8 +592,8 @@ class ConstructionGroupManager {
         var newGroup = ConstructionGroup()
         newGroup.pieces = cluster
         newGroup.anchorPiece = cluster.first
-        newGroup.centerOfMass = calculateCenterOfMass(for: cluster, pieces: pieces)
-        newGroup.boundingRadius = calculateBoundingRadius(for: cluster, pieces: pieces, center: newGroup.centerOfMass)
+        newGroup.centerOfMass = calculateCenterOfMass(for: cluster)
+        newGroup.boundingRadius = calculateBoundingRadius(for: cluster, center: newGroup.centerOfMass)
         
         return newGroup
     }
@@ -501,37 +607,35 @@ class ConstructionGroupManager {
         }
     }
     
-    private func calculateCenterOfMass(for pieces: Set<String>, pieces allPieces: [PuzzlePieceNode]) -> CGPoint {
+    private func calculateCenterOfMass(for pieces: Set<String>) -> CGPoint {
         var sumX: CGFloat = 0
         var sumY: CGFloat = 0
         var count = 0
         
-        for piece in allPieces {
-            if let id = piece.name, pieces.contains(id) {
-                sumX += piece.position.x
-                sumY += piece.position.y
-                count += 1
-            }
+        for id in pieces {
+            guard let geometry = pieceGeometry[id] else { continue }
+            sumX += geometry.position.x
+            sumY += geometry.position.y
+            count += 1
         }
         
         guard count > 0 else { return .zero }
         return CGPoint(x: sumX / CGFloat(count), y: sumY / CGFloat(count))
     }
     
-    private func calculateBoundingRadius(for pieces: Set<String>, pieces allPieces: [PuzzlePieceNode], center: CGPoint) -> CGFloat {
+    private func calculateBoundingRadius(for pieces: Set<String>, center: CGPoint) -> CGFloat {
         var maxDistance: CGFloat = 0
         
-        for piece in allPieces {
-            if let id = piece.name, pieces.contains(id) {
-                let distance = hypot(piece.position.x - center.x, piece.position.y - center.y)
-                maxDistance = max(maxDistance, distance)
-            }
+        for id in pieces {
+            guard let geometry = pieceGeometry[id] else { continue }
+            let distance = hypot(geometry.position.x - center.x, geometry.position.y - center.y)
+            maxDistance = max(maxDistance, distance)
         }
         
         return maxDistance
     }
     
-    private func calculateSpatialSignals(for group: ConstructionGroup, pieces: [PuzzlePieceNode]) -> SpatialSignals {
+    private func calculateSpatialSignals(for group: ConstructionGroup) -> SpatialSignals {
         var signals = SpatialSignals()
         
         // Edge proximity (closer = higher score)
@@ -542,47 +646,48 @@ class ConstructionGroupManager {
         signals.clusterDensity = area > 0 ? Float(group.pieces.count) / Float(area / Config.clusterAreaDivisor) : 0
         
         // Calculate actual angle alignment
-        signals.angleAlignment = calculateAngleAlignment(for: group, pieces: pieces)
+        signals.angleAlignment = calculateAngleAlignment(for: group)
         
         signals.centerOfMass = group.centerOfMass
         
         return signals
     }
     
-    private func calculateAngleAlignment(for group: ConstructionGroup, pieces: [PuzzlePieceNode]) -> Float {
-        // Calculate alignment score based on piece rotations
-        let groupPieces = pieces.filter { piece in
-            guard let id = piece.name else { return false }
-            return group.pieces.contains(id)
-        }
-        
-        guard groupPieces.count > 1 else { return 0 }
+    /// Mean pairwise rotation agreement; pair scores are cached until either piece turns
+    private func calculateAngleAlignment(for group: ConstructionGroup) -> Float {
+        let ids = group.pieces.filter { pieceGeometry[$0] != nil }.sorted()
+        guard ids.count > 1 else { return 0 }
         
         var alignmentScore: Float = 0
         var pairCount = 0
-        
-        // Check angle alignment between all pairs
-        for i in 0..<groupPieces.count {
-            for j in (i+1)..<groupPieces.count {
-                let angle1 = groupPieces[i].zRotation
-                let angle2 = groupPieces[j].zRotation
-                
-                // Calculate minimum angular difference
-                let diff = abs(angle1 - angle2)
-                
-                // Check for 90-degree alignments (common in tangrams)
-                let modDiff = diff.truncatingRemainder(dividingBy: .pi / 2)
-                if modDiff < Config.angleThreshold || modDiff > (.pi / 2 - Config.angleThreshold) {
-                    alignmentScore += 1
-                } else {
-                    alignmentScore += max(0, 1 - Float(modDiff / Config.angleThreshold))
-                }
-                
+        for i in 0..<ids.count {
+            for j in (i+1)..<ids.count {
+                alignmentScore += alignment(for: PiecePair(ids[i], ids[j]))
                 pairCount += 1
             }
         }
         
-        return pairCount > 0 ? alignmentScore / Float(pairCount) : 0
+        return alignmentScore / Float(pairCount)
+    }
+    
+    private func alignment(for pair: PiecePair) -> Float {
+        if let cached = pairAlignment[pair] { return cached }
+        guard let g1 = pieceGeometry[pair.first], let g2 = pieceGeometry[pair.second] else { return 0 }
+        
+        // Calculate minimum angular difference
+        let diff = abs(g1.rotation - g2.rotation)
+        
+        // Check for 90-degree alignments (common in tangrams)
+        let modDiff = diff.truncatingRemainder(dividingBy: .pi / 2)
+        let score: Float
+        if modDiff < Config.angleThreshold || modDiff > (.pi / 2 - Config.angleThreshold) {
+            score = 1
+        } else {
+            score = max(0, 1 - Float(modDiff / Config.angleThreshold))
+        }
+        
+        pairAlignment[pair] = score
+        return score
     }
     
     private func calculateTemporalSignals(for group: ConstructionGroup) -> TemporalSignals {
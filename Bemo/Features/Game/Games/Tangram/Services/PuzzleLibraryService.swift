@@ -23,15 +23,24 @@ class PuzzleLibraryService {
     
     // MARK: - Observable State
     
-    private(set) var availablePuzzles: [GamePuzzleData] = []
+    private(set) var availablePuzzles: [GamePuzzleData] = [] {
+        didSet { silhouetteIndex = nil }
+    }
     private(set) var isLoading = false
     private(set) var loadError: String?
+    /// Target layout problems per puzzle id from the last load's audit; empty until it finishes
+    private(set) var layoutIssues: [String: [TangramAssemblyPlanner.LayoutIssue]] = [:]
     
     // MARK: - Dependencies
     
     private let puzzleManagementService: PuzzleManagementService?
     private let databaseLoader: TangramDatabaseLoader
     
+    // MARK: - Caches
+    
+    /// Shape-similarity index over availablePuzzles, rebuilt on first query after the library changes
+    @ObservationIgnored private var silhouetteIndex: TangramSilhouetteIndex?
+    
     // MARK: - Computed Properties
     
     var categories: [String] {
@@ -65,6 +74,7 @@ class PuzzleLibraryService {
                         self.availablePuzzles = puzzles
                         self.isLoading = false
                         print("[PuzzleLibraryService] Loaded \(puzzles.count) puzzles from cache")
+                        self.auditTargetLayouts(puzzles)
                         
                         // Notify observers that puzzle library has been updated
                         NotificationCenter.default.post(name: .puzzleLibraryDidUpdate, object: nil)
@@ -76,6 +86,7 @@ class PuzzleLibraryService {
                         self.availablePuzzles = puzzles
                         self.isLoading = false
                         print("[PuzzleLibraryService] Loaded \(puzzles.count) puzzles from database")
+                        self.auditTargetLayouts(puzzles)
                         
                         // Notify observers that puzzle library has been updated
                         NotificationCenter.default.post(name: .puzzleLibraryDidUpdate, object: nil)
@@ -92,6 +103,20 @@ class PuzzleLibraryService {
         }
     }
     
+    /// Audit target layouts off the main actor; results land in layoutIssues
+    private func auditTargetLayouts(_ puzzles: [GamePuzzleData]) {
+        Task.detached(priority: .utility) { [weak self] in
+            let issues = TangramAssemblyPlanner.auditTargetLayouts(puzzles)
+            await MainActor.run {
+                guard let self else { return }
+                self.layoutIssues = issues
+                if !issues.isEmpty {
+                    print("[PuzzleLibraryService] \(issues.count) puzzle(s) failed the target layout audit: \(issues.keys.sorted())")
+                }
+            }
+        }
+    }
+    
     /// Force refresh puzzles from cache (called after editor saves)
     func refreshPuzzles() {
         print("[PuzzleLibraryService] Refreshing puzzles...")
@@ -172,6 +197,29 @@ class PuzzleLibraryService {
         case category   // Sort alphabetically by category
     }
     
+    // MARK: - Shape Similarity
+    
+    /// Puzzles whose silhouettes look most like the given puzzle (rotation, flip and scale invariant)
+    func similarPuzzles(to puzzle: GamePuzzleData, limit: Int = 5) -> [GamePuzzleData] {
+        let matches = shapeIndex().similar(to: puzzle.id, limit: limit)
+        let byId = Dictionary(availablePuzzles.map { ($0.id, $0) }, uniquingKeysWith: { first, _ in first })
+        return matches.compactMap { byId[$0.puzzleId] }
+    }
+    
+    /// Puzzle id pairs whose silhouettes are effectively the same shape
+    func nearDuplicatePuzzleIds() -> [(String, String)] {
+        shapeIndex().nearDuplicates()
+    }
+    
+    private func shapeIndex() -> TangramSilhouetteIndex {
+        if let index = silhouetteIndex {
+            return index
+        }
+        let index = TangramSilhouetteIndex(puzzles: availablePuzzles)
+        silhouetteIndex = index
+        return index
+    }
+    
     // MARK: - Thumbnail Management
     
     func thumbnailImage(for puzzle: GamePuzzleData) -> Image? {
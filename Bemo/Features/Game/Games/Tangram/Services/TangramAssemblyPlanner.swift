@@ -0,0 +1,201 @@
+//
+//  TangramAssemblyPlanner.swift
+//  Bemo
+//
+//  Exhaustive build-order planner and target layout audit over a compiled puzzle graph
+//
+
+// WHAT: Finds the cheapest connected order to complete a puzzle from a partial placement, and audits target layouts
+// ARCHITECTURE: Service in MVVM-S, stateless; used by TangramHintEngine (next piece) and PuzzleLibraryService (library audit)
+// USAGE: Create with a TangramPuzzleGraph + adjacency, call nextStep()/plan(); call auditTargetLayouts() once per loaded library
+
+import Foundation
+import CoreGraphics
+
+/// Memoized search over target bitmasks. Every step must touch the growing cluster, so the
+/// returned plan is the cheapest way to finish the silhouette while staying connected, or
+/// proves no connected completion exists from the current placement.
+struct TangramAssemblyPlanner {
+
+    // MARK: - Types
+
+    struct Plan {
+        /// Target indices (into graph.targetIds) in build order
+        let order: [Int]
+        let cost: CGFloat
+        /// False when some targets cannot be reached without a disconnected placement
+        let isComplete: Bool
+    }
+
+    enum LayoutIssue: Equatable {
+        case duplicatePiece(TangramPieceType)
+        case overlap(String, String)
+        case disconnected(components: Int)
+    }
+
+    // MARK: - Configuration
+
+    /// Cost charged per target left unreachable; dominates any real step cost
+    static let unreachablePenalty: CGFloat = 1000
+    /// Penetration depth (SK points) above which two targets are considered overlapping rather than touching
+    static let overlapTolerance: CGFloat = 2
+
+    // MARK: - Properties
+
+    let graph: TangramPuzzleGraph
+    let adjacency: [UInt64]
+    /// Base cost of placing each target with no supporting neighbors
+    private let baseCost: [CGFloat]
+
+    // MARK: - Initialization
+
+    init(graph: TangramPuzzleGraph, adjacency: [UInt64], baseCost: (TangramPieceType) -> CGFloat) {
+        self.graph = graph
+        self.adjacency = adjacency
+        self.baseCost = graph.pieceTypes.map(baseCost)
+    }
+
+    // MARK: - Planning
+
+    /// Cheapest first step from the given cluster. `adjustment` biases only the immediate choice
+    /// (recent hints, user intent); the remainder of the plan is scored on structure alone.
+    func nextStep(cluster: UInt64, validated: UInt64, adjustment: (Int) -> CGFloat = { _ in 0 }) -> Int? {
+        var memo: [UInt64: CGFloat] = [:]
+        let built = validated | cluster
+        var best: (index: Int, cost: CGFloat)?
+        var bits = frontier(of: cluster, built: built)
+        while bits != 0 {
+            let i = bits.trailingZeroBitCount
+            bits &= bits - 1
+            let next = grow(cluster, adding: i, validated: validated)
+            let cost = stepCost(i, cluster: cluster) + adjustment(i) + remainingCost(next, validated: validated, memo: &memo)
+            if best == nil || cost < best!.cost { best = (i, cost) }
+        }
+        return best?.index
+    }
+
+    /// Full cheapest connected build order from the given cluster
+    func plan(cluster: UInt64, validated: UInt64) -> Plan {
+        var memo: [UInt64: CGFloat] = [:]
+        let total = remainingCost(cluster, validated: validated, memo: &memo)
+
+        // Walk the memo table to recover the order
+        var order: [Int] = []
+        var current = cluster
+        while true {
+            let built = validated | current
+            var best: (index: Int, next: UInt64, cost: CGFloat)?
+            var bits = frontier(of: current, built: built)
+            while bits != 0 {
+                let i = bits.trailingZeroBitCount
+                bits &= bits - 1
+                let next = grow(current, adding: i, validated: validated)
+                let cost = stepCost(i, cluster: current) + remainingCost(next, validated: validated, memo: &memo)
+                if best == nil || cost < best!.cost { best = (i, next, cost) }
+            }
+            guard let step = best else { break }
+            order.append(step.index)
+            current = step.next
+        }
+
+        let complete = (graph.allMask & ~(validated | current)) == 0
+        return Plan(order: order, cost: total, isComplete: complete)
+    }
+
+    // MARK: - Search
+
+    private func frontier(of cluster: UInt64, built: UInt64) -> UInt64 {
+        TangramPuzzleGraph.neighbors(of: cluster, adjacency: adjacency) & graph.allMask & ~built
+    }
+
+    /// Add a target to the cluster and absorb any validated components it now touches
+    private func grow(_ cluster: UInt64, adding index: Int, validated: UInt64) -> UInt64 {
+        var result = cluster | (UInt64(1) << UInt64(index))
+        var frontier = result
+        while frontier != 0 {
+            let absorbed = TangramPuzzleGraph.neighbors(of: frontier, adjacency: adjacency) & validated & ~result
+            result |= absorbed
+            frontier = absorbed
+        }
+        return result
+    }
+
+    /// Targets already touching the cluster make a placement easier
+    private func stepCost(_ index: Int, cluster: UInt64) -> CGFloat {
+        let contacts = (adjacency[index] & cluster).nonzeroBitCount
+        return baseCost[index] / CGFloat(1 + contacts)
+    }
+
+    /// Minimum cost to finish from a cluster; the cluster determines the state because validated targets are fixed
+    private func remainingCost(_ cluster: UInt64, validated: UInt64, memo: inout [UInt64: CGFloat]) -> CGFloat {
+        if let cached = memo[cluster] { return cached }
+        let built = validated | cluster
+        var bits = frontier(of: cluster, built: built)
+        var best: CGFloat
+        if bits == 0 {
+            best = CGFloat((graph.allMask & ~built).nonzeroBitCount) * Self.unreachablePenalty
+        } else {
+            best = .greatestFiniteMagnitude
+            while bits != 0 {
+                let i = bits.trailingZeroBitCount
+                bits &= bits - 1
+                let next = grow(cluster, adding: i, validated: validated)
+                best = min(best, stepCost(i, cluster: cluster) + remainingCost(next, validated: validated, memo: &memo))
+            }
+        }
+        memo[cluster] = best
+        return best
+    }
+
+    // MARK: - Target Layout Audit
+
+    /// Checks a puzzle's target layout against one tangram set: each piece used at most once,
+    /// no two targets overlapping, every target reachable along shared edges. This inspects the
+    /// stored targets only; it does not prove the silhouette has no other decomposition.
+    static func auditTargetLayout(_ graph: TangramPuzzleGraph) -> [LayoutIssue] {
+        var issues: [LayoutIssue] = []
+
+        var seen = Set<TangramPieceType>()
+        for type in graph.pieceTypes where !seen.insert(type).inserted {
+            issues.append(.duplicatePiece(type))
+        }
+
+        let shapes = zip(graph.targetIds, graph.polygonsSK).map { TangramOverlapDetector.Shape(pieceId: $0, vertices: $1) }
+        for i in 0..<shapes.count {
+            for j in (i + 1)..<shapes.count
+            where TangramOverlapDetector.hasAreaOverlap(shapes[i], shapes[j], tolerance: overlapTolerance) {
+                issues.append(.overlap(graph.targetIds[i], graph.targetIds[j]))
+            }
+        }
+
+        let adjacency = graph.adjacency(for: nil)
+        var remaining = graph.allMask
+        var components = 0
+        while remaining != 0 {
+            var component = UInt64(1) << UInt64(remaining.trailingZeroBitCount)
+            var frontier = component
+            while frontier != 0 {
+                let next = TangramPuzzleGraph.neighbors(of: frontier, adjacency: adjacency) & remaining & ~component
+                component |= next
+                frontier = next
+            }
+            remaining &= ~component
+            components += 1
+        }
+        if components > 1 {
+            issues.append(.disconnected(components: components))
+        }
+
+        return issues
+    }
+
+    /// Layout issues per puzzle id for every puzzle with targets; puzzles that pass are left out
+    static func auditTargetLayouts(_ puzzles: [GamePuzzleData]) -> [String: [LayoutIssue]] {
+        var result: [String: [LayoutIssue]] = [:]
+        for puzzle in puzzles where !puzzle.targetPieces.isEmpty {
+            let issues = auditTargetLayout(TangramPuzzleGraph(puzzle: puzzle))
+            if !issues.isEmpty { result[puzzle.id] = issues }
+        }
+        return result
+    }
+}
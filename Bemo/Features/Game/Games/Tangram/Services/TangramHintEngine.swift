@@ -92,6 +92,8 @@ class TangramHintEngine {
     // MARK: - Properties
     
     private var currentDifficulty: UserPreferences.DifficultySetting = .normal
+    // Target adjacency compiled once per puzzle (see TangramPuzzleGraph)
+    private var compiledGraph: TangramPuzzleGraph?
     
     // MARK: - Public Interface
     
@@ -161,88 +163,14 @@ class TangramHintEngine {
     }
     // MARK: - Connection-aware selection
     
-    private func buildAdjacency(for puzzle: GamePuzzleData, difficultySetting: UserPreferences.DifficultySetting? = nil) -> [String: Set<String>] {
-        // Build polygon per target id in SK space
-        var idToPolygon: [String: [CGPoint]] = [:]
-        for t in puzzle.targetPieces {
-            let verts = TangramGameGeometry.normalizedVertices(for: t.pieceType)
-            let scaled = TangramGameGeometry.scaleVertices(verts, by: TangramGameConstants.visualScale)
-            let transformed = TangramGameGeometry.transformVertices(scaled, with: t.transform)
-            let sk = transformed.map { TangramPoseMapper.spriteKitPosition(fromRawPosition: $0) }
-            idToPolygon[t.id] = sk
+    /// Returns the compiled target graph, recompiling only when the puzzle changes
+    private func puzzleGraph(for puzzle: GamePuzzleData) -> TangramPuzzleGraph {
+        if let cached = compiledGraph, cached.matches(puzzle) {
+            return cached
         }
-        
-        // Adjacent if min edge distance < tolerance and edges roughly parallel
-        let edgeTolerance: CGFloat = {
-            if let d = difficultySetting { return TangramGameConstants.Validation.tolerances(for: d).edgeContact }
-            return 14
-        }()  // Slightly more generous to ensure adjacency is detected
-        var adj: [String: Set<String>] = [:]
-        let ids = puzzle.targetPieces.map { $0.id }
-        for i in 0..<ids.count {
-            for j in (i+1)..<ids.count {
-                guard let p1 = idToPolygon[ids[i]], let p2 = idToPolygon[ids[j]] else { continue }
-                if polygonsAdjacent(p1, p2, edgeTolerance: edgeTolerance) {
-                    adj[ids[i], default: []].insert(ids[j])
-                    adj[ids[j], default: []].insert(ids[i])
-                }
-            }
-        }
-        return adj
-    }
-    
-    private func polygonsAdjacent(_ a: [CGPoint], _ b: [CGPoint], edgeTolerance: CGFloat) -> Bool {
-        // Simple min-edge-distance check with parallelism heuristic
-        func edges(_ poly: [CGPoint]) -> [(CGPoint, CGPoint)] {
-            guard poly.count > 1 else { return [] }
-            return (0..<poly.count).map { i in
-                (poly[i], poly[(i+1) % poly.count])
-            }
-        }
-        let ea = edges(a)
-        let eb = edges(b)
-        for (a0, a1) in ea {
-            for (b0, b1) in eb {
-                // Distance between segments
-                let d = segmentDistance(a0, a1, b0, b1)
-                if d <= edgeTolerance {
-                    // Check parallelism (dot product of normals ~ 0)
-                    let va = CGVector(dx: a1.x - a0.x, dy: a1.y - a0.y)
-                    let vb = CGVector(dx: b1.x - b0.x, dy: b1.y - b0.y)
-                    let na = CGVector(dx: -va.dy, dy: va.dx)
-                    let nb = CGVector(dx: -vb.dy, dy: vb.dx)
-                    let dot = na.dx*nb.dx + na.dy*nb.dy
-                    let mag = hypot(na.dx, na.dy) * hypot(nb.dx, nb.dy)
-                    if mag > 0, abs(dot/mag) < 0.2 { return true }
-                }
-            }
-        }
-        return false
-    }
-    
-    private func segmentDistance(_ p1: CGPoint, _ p2: CGPoint, _ p3: CGPoint, _ p4: CGPoint) -> CGFloat {
-        // Compute min distance between two segments
-        func clamp(_ x: CGFloat, _ lo: CGFloat, _ hi: CGFloat) -> CGFloat { max(lo, min(hi, x)) }
-        let u = CGVector(dx: p2.x - p1.x, dy: p2.y - p1.y)
-        let v = CGVector(dx: p4.x - p3.x, dy: p4.y - p3.y)
-        let w0 = CGVector(dx: p1.x - p3.x, dy: p1.y - p3.y)
-        let a = u.dx*u.dx + u.dy*u.dy
-        let b = u.dx*v.dx + u.dy*v.dy
-        let c = v.dx*v.dx + v.dy*v.dy
-        let d = u.dx*w0.dx + u.dy*w0.dy
-        let e = v.dx*w0.dx + v.dy*w0.dy
-        let denom = a*c - b*b
-        var sc: CGFloat, tc: CGFloat
-        if denom < 1e-6 {
-            sc = 0
-            tc = clamp(e/c, 0, 1)
-        } else {
-            sc = clamp((b*e - c*d)/denom, 0, 1)
-            tc = clamp((a*e - b*d)/denom, 0, 1)
-        }
-        let dpx = w0.dx + sc*u.dx - tc*v.dx
-        let dpy = w0.dy + sc*u.dy - tc*v.dy
-        return hypot(dpx, dpy)
+        let graph = TangramPuzzleGraph(puzzle: puzzle)
+        compiledGraph = graph
+        return graph
     }
     
     // New frontier-based, connection-aware selection that avoids repeating the same disconnected piece
@@ -251,108 +179,60 @@ class TangramHintEngine {
                                                  placedPieces: [PlacedPiece],
                                                  previousHints: [HintData],
                                                  difficultySetting: UserPreferences.DifficultySetting? = nil) -> String? {
-        let adj = buildAdjacency(for: puzzle, difficultySetting: difficultySetting)
-        let allIds = Set(puzzle.targetPieces.map { $0.id })
-        let unvalidatedIds = allIds.subtracting(validated)
+        let graph = puzzleGraph(for: puzzle)
+        let adj = graph.adjacency(for: difficultySetting)
+        let validatedMask = graph.mask(for: validated)
+        let unvalidatedMask = graph.allMask & ~validatedMask
 
         // Find the largest connected component within the validated set
-        let component = largestValidatedComponent(validated: validated, adjacency: adj)
-        if component.isEmpty { return nil }
+        let component = TangramPuzzleGraph.largestComponent(within: validatedMask, adjacency: adj)
+        if component == 0 { return nil }
 
         // Frontier = neighbors of component that are unvalidated
-        var frontier: Set<String> = []
-        for v in component {
-            if let ns = adj[v] {
-                for n in ns where unvalidatedIds.contains(n) {
-                    frontier.insert(n)
-                }
-            }
-        }
-        if frontier.isEmpty { return nil }
+        let frontier = TangramPuzzleGraph.neighbors(of: component, adjacency: adj) & unvalidatedMask
+        if frontier == 0 { return nil }
 
-        // Build scoring
         // Compute centroid of component for proximity
-        let centroid: CGPoint = centroidOf(ids: component, puzzle: puzzle)
+        let centroid: CGPoint = graph.centroid(of: component)
         // Recent hint penalty to avoid repeating same piece type endlessly
         let recentPieceTypes = Set(previousHints.suffix(2).map { $0.targetPiece })
         // Prefer candidates near any incorrectly placed piece the user is trying
         let incorrectTypesNearby: Set<TangramPieceType> = Set(placedPieces.filter { $0.validationState != .correct }.map { $0.pieceType })
 
-        var best: (id: String, score: CGFloat)?
-        for id in frontier {
-            guard let t = puzzle.targetPieces.first(where: { $0.id == id }) else { continue }
-            let neighbors = adj[id] ?? []
-            let neighborsOpened = neighbors.filter { unvalidatedIds.contains($0) }.count
-            let neighborValidatedCount = neighbors.filter { component.contains($0) }.count
-            let posRaw = TangramPoseMapper.rawPosition(from: t.transform)
-            let posSK = TangramPoseMapper.spriteKitPosition(fromRawPosition: posRaw)
-            let proximity = 1 / max(1, hypot(posSK.x - centroid.x, posSK.y - centroid.y))
-            let diffPenalty: CGFloat = CGFloat(getPieceDifficulty(t.pieceType).rawValue) * 0.06
-            let repeatPenalty: CGFloat = recentPieceTypes.contains(t.pieceType) ? 0.5 : 0.0
-            let userIntentBoost: CGFloat = incorrectTypesNearby.contains(t.pieceType) ? 0.4 : 0.0
-
-            // Score weights: prioritize tying into current cluster (neighborValidatedCount), next openings, then proximity
-            let score = CGFloat(neighborValidatedCount) * 5
-                     + CGFloat(neighborsOpened) * 3
-                     + proximity * 1.5
-                     + userIntentBoost
-                     - diffPenalty
-                     - repeatPenalty
-
-            if best == nil || score > best!.score { best = (id, score) }
+        // Plan the whole remaining build order; hint the first step of the cheapest connected completion
+        let planner = TangramAssemblyPlanner(graph: graph, adjacency: adj) { pieceType in
+            CGFloat(getPieceDifficulty(pieceType).rawValue)
         }
-
-        return best?.id
-    }
-
-    private func largestValidatedComponent(validated: Set<String>, adjacency: [String: Set<String>]) -> Set<String> {
-        var visited: Set<String> = []
-        var best: Set<String> = []
-        for start in validated where !visited.contains(start) {
-            var comp: Set<String> = []
-            var stack: [String] = [start]
-            visited.insert(start)
-            while let v = stack.popLast() {
-                comp.insert(v)
-                for n in (adjacency[v] ?? []) where validated.contains(n) && !visited.contains(n) {
-                    visited.insert(n)
-                    stack.append(n)
-                }
-            }
-            if comp.count > best.count { best = comp }
+        let next = planner.nextStep(cluster: component, validated: validatedMask) { i in
+            let pieceType = graph.pieceTypes[i]
+            let posSK = graph.positionsSK[i]
+            let proximity = 1 / max(1, hypot(posSK.x - centroid.x, posSK.y - centroid.y))
+            let repeatPenalty: CGFloat = recentPieceTypes.contains(pieceType) ? 0.5 : 0.0
+            let userIntentBoost: CGFloat = incorrectTypesNearby.contains(pieceType) ? 0.4 : 0.0
+            return repeatPenalty - userIntentBoost - proximity * 1.5
         }
-        return best
-    }
 
-    private func centroidOf(ids: Set<String>, puzzle: GamePuzzleData) -> CGPoint {
-        var sum = CGPoint.zero; var count: CGFloat = 0
-        for id in ids {
-            if let t = puzzle.targetPieces.first(where: { $0.id == id }) {
-                let raw = TangramPoseMapper.rawPosition(from: t.transform)
-                let sk = TangramPoseMapper.spriteKitPosition(fromRawPosition: raw)
-                sum.x += sk.x; sum.y += sk.y; count += 1
-            }
-        }
-        if count == 0 { return .zero }
-        return CGPoint(x: sum.x/count, y: sum.y/count)
+        return next.map { graph.targetIds[$0] }
     }
 
     // Fallback when adjacency fails: nearest remaining target to the centroid of validated cluster
     private func selectNearestToValidated(puzzle: GamePuzzleData,
                                           validated: Set<String>,
                                           previousHints: [HintData]) -> TangramPieceType? {
-        let centroid = centroidOf(ids: validated, puzzle: puzzle)
-        let remaining = Set(puzzle.targetPieces.map { $0.id }).subtracting(validated)
+        let graph = puzzleGraph(for: puzzle)
+        let validatedMask = graph.mask(for: validated)
+        let centroid = graph.centroid(of: validatedMask)
         let recent = Set(previousHints.suffix(2).map { $0.targetPiece })
         var best: (type: TangramPieceType, dist: CGFloat)?
-        for id in remaining {
-            guard let t = puzzle.targetPieces.first(where: { $0.id == id }) else { continue }
-            let raw = TangramPoseMapper.rawPosition(from: t.transform)
-            let sk = TangramPoseMapper.spriteKitPosition(fromRawPosition: raw)
+        var bits = graph.allMask & ~validatedMask
+        while bits != 0 {
+            let i = bits.trailingZeroBitCount
+            bits &= bits - 1
+            let sk = graph.positionsSK[i]
             let d = hypot(sk.x - centroid.x, sk.y - centroid.y)
-            let penalty: CGFloat = recent.contains(t.pieceType) ? 30 : 0
+            let penalty: CGFloat = recent.contains(graph.pieceTypes[i]) ? 30 : 0
             let adj = d + penalty
-            if best == nil || adj < best!.dist { best = (t.pieceType, adj) }
+            if best == nil || adj < best!.dist { best = (graph.pieceTypes[i], adj) }
         }
         return best?.type
     }
@@ -361,49 +241,46 @@ class TangramHintEngine {
     private func selectFrontierFromPlacedPieces(puzzle: GamePuzzleData,
                                                 placedPieces: [PlacedPiece],
                                                 previousHints: [HintData]) -> TangramPieceType? {
-        let adj = buildAdjacency(for: puzzle)
+        let graph = puzzleGraph(for: puzzle)
+        let adj = graph.adjacency(for: nil)
         // Project placed pieces onto nearest targets of the same type within a loose threshold
-        var seed: Set<String> = []
+        var seed: UInt64 = 0
         for p in placedPieces {
             // Only consider stationary or slowly moving pieces to avoid noise
             if !p.isPlacedLongEnough() { continue }
-            var best: (id: String, dist: CGFloat)?
-            for t in puzzle.targetPieces where t.pieceType == p.pieceType {
-                let raw = TangramPoseMapper.rawPosition(from: t.transform)
-                let sk = TangramPoseMapper.spriteKitPosition(fromRawPosition: raw)
+            var best: (index: Int, dist: CGFloat)?
+            for i in graph.pieceTypes.indices where graph.pieceTypes[i] == p.pieceType {
+                let sk = graph.positionsSK[i]
                 let d = hypot(p.position.x - sk.x, p.position.y - sk.y)
-                if best == nil || d < best!.dist { best = (t.id, d) }
+                if best == nil || d < best!.dist { best = (i, d) }
             }
             if let best = best, best.dist < 140 { // generous to capture intent
-                seed.insert(best.id)
+                seed |= UInt64(1) << UInt64(best.index)
             }
         }
-        if seed.isEmpty { return nil }
+        if seed == 0 { return nil }
 
         // Build frontier around projected seed
-        var frontier: Set<String> = []
-        for s in seed {
-            if let ns = adj[s] {
-                frontier.formUnion(ns.filter { !seed.contains($0) })
-            }
-        }
-        if frontier.isEmpty { return nil }
+        let frontier = TangramPuzzleGraph.neighbors(of: seed, adjacency: adj) & ~seed
+        if frontier == 0 { return nil }
 
-        let centroid = centroidOf(ids: seed, puzzle: puzzle)
+        let centroid = graph.centroid(of: seed)
         let recentTypes = Set(previousHints.suffix(2).map { $0.targetPiece })
 
         var bestPick: (type: TangramPieceType, score: CGFloat)?
-        for id in frontier {
-            guard let t = puzzle.targetPieces.first(where: { $0.id == id }) else { continue }
-            let neighbors = adj[id] ?? []
-            let neighborSeedCount = neighbors.filter { seed.contains($0) }.count
-            let raw = TangramPoseMapper.rawPosition(from: t.transform)
-            let sk = TangramPoseMapper.spriteKitPosition(fromRawPosition: raw)
+        var bits = frontier
+        while bits != 0 {
+            let i = bits.trailingZeroBitCount
+            bits &= bits - 1
+            let pieceType = graph.pieceTypes[i]
+            // Edge shared with the seed, in small-triangle legs
+            let sharedWithSeed = graph.sharedEdgeLength(of: i, with: seed, difficulty: nil) / TangramGameConstants.visualScale
+            let sk = graph.positionsSK[i]
             let proximity = 1 / max(1, hypot(sk.x - centroid.x, sk.y - centroid.y))
-            let diffPenalty: CGFloat = CGFloat(getPieceDifficulty(t.pieceType).rawValue) * 0.05
-            let repeatPenalty: CGFloat = recentTypes.contains(t.pieceType) ? 0.4 : 0.0
-            let score = CGFloat(neighborSeedCount) * 5 + proximity * 1.5 - diffPenalty - repeatPenalty
-            if bestPick == nil || score > bestPick!.score { bestPick = (t.pieceType, score) }
+            let diffPenalty: CGFloat = CGFloat(getPieceDifficulty(pieceType).rawValue) * 0.05
+            let repeatPenalty: CGFloat = recentTypes.contains(pieceType) ? 0.4 : 0.0
+            let score = sharedWithSeed * 5 + proximity * 1.5 - diffPenalty - repeatPenalty
+            if bestPick == nil || score > bestPick!.score { bestPick = (pieceType, score) }
         }
         return bestPick?.type
     }
@@ -58,6 +58,8 @@ class TangramValidationEngine {
         let failureReasons: [String: ValidationFailure]
         let orientedTargets: Set<String> // targets that match orientation-only (50% fill)
         let anchorPieceIds: Set<String>
+        /// Whole-silhouette coverage of all mapped pieces; nil until an anchor mapping exists
+        let silhouetteCoverage: TangramSilhouetteCoverage.Score?
     }
 
     struct LockedValidation {
@@ -110,6 +112,10 @@ class TangramValidationEngine {
     private let invalidationSlackPosition: CGFloat = 18 // px
     private let invalidationSlackRotationDeg: CGFloat = 8 // deg
     private let invalidationDwellSeconds: TimeInterval = 0.5
+    // Precomputed target centroids/feature angles for the active puzzle
+    private var targetIndex: TangramTargetFeatureIndex?
+    // Pre-rasterized silhouette for the active puzzle
+    private var coverageModel: TangramSilhouetteCoverage?
     
     // MARK: - Initialization
     
@@ -142,6 +148,7 @@ class TangramValidationEngine {
     ) -> ValidationResult {
         // Follow plan doc: two-piece rigid mapping commit, then relative validation
         let enableAnchorMapping = true
+        let index = targetFeatureIndex(for: puzzle)
         
         // Filter observations to significant pose deltas (only track pieces once moved)
         let significant: [PieceObservation] = frame.filter { obs in
@@ -154,8 +161,6 @@ class TangramValidationEngine {
         }
         // Update pose cache for all observations
         for obs in frame { lastObservedPose[obs.pieceId] = (obs.position, obs.rotation) }
-        // Detect moving pieces (velocity-based) to freeze mapping persistence during manipulation
-        let _ = frame.contains { hypot($0.velocity.dx, $0.velocity.dy) > 10.0 }
         // SIMPLE TWO-PIECE ANCHOR + ORIENTATION-ONLY FEEDBACK
         var orientedTargets: Set<String> = []
         var pieceStates: [String: PieceValidationState] = [:]
@@ -163,6 +168,7 @@ class TangramValidationEngine {
         var groupMappingsOut: [UUID: AnchorMapping] = [:]
         var failureReasons: [String: ValidationFailure] = [:]
         var anchorIds: Set<String> = []
+        var coverageScore: TangramSilhouetteCoverage.Score?
 
         // Establish or maintain a two-piece anchor mapping if possible
         if enableAnchorMapping && frame.count >= 2 {
@@ -176,98 +182,51 @@ class TangramValidationEngine {
                let obsA = idToObs[a], let obsB = idToObs[b] {
                 candidatePair = (obsA, obsB)
             } else {
-                // Compute orientation deltas to pick a pair likely to be aligned to targets
-                struct OrientInfo { let obs: PieceObservation; let bestTargetId: String; let deltaDeg: CGFloat; let flipOK: Bool }
-                var oriented: [OrientInfo] = []
+                // Orientation deltas against precomputed target features pick a pair likely aligned to targets
+                var oriented: [PieceObservation] = []
                 for obs in frame {
-                    let candidates = puzzle.targetPieces.filter { $0.pieceType == obs.pieceType }
-                    guard !candidates.isEmpty else { continue }
-                    let canonicalPiece: CGFloat = obs.pieceType.isTriangle ? (3 * .pi / 4) : 0
-                    let pieceFeature = TangramRotationValidator.normalizeAngle(
-                        obs.rotation + (obs.isFlipped ? -canonicalPiece : canonicalPiece)
+                    let pieceFeature = TangramTargetFeatureIndex.pieceFeatureAngle(
+                        rotation: obs.rotation,
+                        isFlipped: obs.isFlipped,
+                        pieceType: obs.pieceType
                     )
-                    var best: (id: String, deltaDeg: CGFloat, flippedOK: Bool)?
-                    for t in candidates {
-                        let raw = TangramPoseMapper.rawAngle(from: t.transform)
-                        let targRot = TangramPoseMapper.spriteKitAngle(fromRawAngle: raw)
-                        let canonicalTarget: CGFloat = obs.pieceType.isTriangle ? (.pi / 4) : 0
-                        let targetFeature = TangramRotationValidator.normalizeAngle(targRot + canonicalTarget)
-                        let symDiff = TangramRotationValidator.rotationDifferenceToNearest(
-                            currentRotation: pieceFeature,
-                            targetRotation: targetFeature,
-                            pieceType: obs.pieceType,
-                            isFlipped: obs.isFlipped
-                        )
-                        let delta = abs(symDiff) * 180 / .pi
-                        let det = t.transform.a * t.transform.d - t.transform.b * t.transform.c
-                        let targFlipped = det < 0
-                        let flipOK = (obs.pieceType != .parallelogram) || (obs.isFlipped != targFlipped)
-                        if best == nil || delta < best!.deltaDeg { best = (t.id, delta, flipOK) }
-                    }
-                    if let b = best, b.flippedOK, b.deltaDeg <= max(5, options.orientationToleranceDeg) {
-                        oriented.append(OrientInfo(obs: obs, bestTargetId: b.id, deltaDeg: b.deltaDeg, flipOK: b.flippedOK))
-                    }
-                }
-                if oriented.count >= 2 {
-                    // Choose closest pair among oriented
-                    var bestPair: (PieceObservation, PieceObservation)? = nil
-                    var bestDist: CGFloat = .infinity
-                    for i in 0..<(oriented.count - 1) {
-                        for j in (i + 1)..<oriented.count {
-                            let p = oriented[i].obs.position
-                            let q = oriented[j].obs.position
-                            let d = hypot(p.x - q.x, p.y - q.y)
-                            if d < bestDist { bestDist = d; bestPair = (oriented[i].obs, oriented[j].obs) }
-                        }
+                    var best: (deltaDeg: CGFloat, flipOK: Bool)?
+                    for entry in index.candidates(for: obs.pieceType) {
+                        let delta = abs(TangramTargetFeatureIndex.symmetricDelta(pieceFeature: pieceFeature, entry: entry)) * 180 / .pi
+                        let flipOK = (obs.pieceType != .parallelogram) || (obs.isFlipped != entry.isFlipped)
+                        if best == nil || delta < best!.deltaDeg { best = (delta, flipOK) }
                     }
-                    candidatePair = bestPair
-                    #if DEBUG
-                    if let cp = candidatePair {
-                        print("[ANCHOR] Oriented pair selected: \(cp.0.pieceId), \(cp.1.pieceId) (closest among oriented)")
+                    if let b = best, b.flipOK, b.deltaDeg <= max(5, options.orientationToleranceDeg) {
+                        oriented.append(obs)
                     }
-                    #endif
                 }
-                if candidatePair == nil {
-                    // Fallback to closest pair in frame
-                    var bestPair: (PieceObservation, PieceObservation)? = nil
-                    var bestDist: CGFloat = .infinity
-                    for i in 0..<(frame.count - 1) {
-                        for j in (i + 1)..<frame.count {
-                            let p = frame[i].position
-                            let q = frame[j].position
-                            let d = hypot(p.x - q.x, p.y - q.y)
-                            if d < bestDist { bestDist = d; bestPair = (frame[i], frame[j]) }
-                        }
-                    }
-                    candidatePair = bestPair
-                    #if DEBUG
-                    if let cp = candidatePair {
-                        print("[ANCHOR] Fallback closest pair selected: \(cp.0.pieceId), \(cp.1.pieceId)")
-                    }
-                    #endif
+                // Choose closest pair among oriented, falling back to closest pair in frame
+                candidatePair = closestPair(in: oriented) ?? closestPair(in: frame)
+                #if DEBUG
+                if let cp = candidatePair {
+                    let mode = oriented.count >= 2 ? "Oriented pair selected" : "Fallback closest pair selected"
+                    print("[ANCHOR] \(mode): \(cp.0.pieceId), \(cp.1.pieceId)")
                 }
+                #endif
             }
 
             if let pair = candidatePair {
                 let groupId: UUID = mainGroupId ?? UUID()
                 // Compute mapping using plan doc method (pair-centric centroid + relative rotation)
-                let mapping = computePairDocMapping(pair: pair, puzzle: puzzle)
+                let mapping = computePairDocMapping(pair: pair, index: index)
 
                 if let mapping = mapping, let anchorObs = idToObs[mapping.anchorPieceId] {
                     // Validate both pieces under this mapping
                     let pairObs: [PieceObservation] = [pair.0, pair.1]
                     var localStates: [String: PieceValidationState] = [:]
-                    var localValidatedTargets: Set<String> = []
                     for obs in pairObs {
-                        let st = validateMappedPiece(
+                        localStates[obs.pieceId] = validateMappedPiece(
                             observation: obs,
                             mapping: mapping,
                             anchorPosition: anchorObs.position,
-                            puzzle: puzzle,
+                            index: index,
                             difficulty: difficulty
                         )
-                        localStates[obs.pieceId] = st
-                        if st.isValid, let tid = st.targetId { localValidatedTargets.insert(tid) }
                     }
 
                     // Anchor is established if both pass strict validation, or
@@ -281,35 +240,17 @@ class TangramValidationEngine {
                         let rotRelaxDeg = tolerances.rotationDeg * 1.2
                         var okCount = 0
                         for obs in pairObs {
-                            // Determine target from local state if available, else pick best by type
-                            var targetId: String? = localStates[obs.pieceId]?.targetId
-                            if targetId == nil {
-                                targetId = puzzle.targetPieces.first(where: { $0.pieceType == obs.pieceType })?.id
-                            }
-                            if let tid = targetId, let target = puzzle.targetPieces.first(where: { $0.id == tid }) {
-                                let mapped = mappingService.mapPieceToTargetSpace(
-                                    piecePositionScene: obs.position,
-                                    pieceRotation: obs.rotation,
-                                    pieceIsFlipped: obs.isFlipped,
+                            // Determine target from local state if available, else pick first by type
+                            let entry = localStates[obs.pieceId]?.targetId.flatMap { index.entry(for: $0) }
+                                ?? index.candidates(for: obs.pieceType).first
+                            if let entry = entry {
+                                let residual = mappedResiduals(
+                                    observation: obs,
+                                    entry: entry,
                                     mapping: mapping,
-                                    anchorPositionScene: anchorObs.position
-                                )
-                                let verts = TangramBounds.computeSKTransformedVertices(for: target)
-                                let centroid = CGPoint(
-                                    x: verts.map { $0.x }.reduce(0, +) / CGFloat(max(1, verts.count)),
-                                    y: verts.map { $0.y }.reduce(0, +) / CGFloat(max(1, verts.count))
-                                )
-                                let posDist = hypot(mapped.positionSK.x - centroid.x, mapped.positionSK.y - centroid.y)
-                                let canonicalPiece: CGFloat = obs.pieceType.isTriangle ? (3 * .pi / 4) : 0
-                                let canonicalTarget: CGFloat = obs.pieceType.isTriangle ? (.pi / 4) : 0
-                                let pieceFeature = TangramRotationValidator.normalizeAngle(
-                                    mapped.rotationSK + (mapped.isFlipped ? -canonicalPiece : canonicalPiece)
-                                )
-                                let targetFeature = TangramRotationValidator.normalizeAngle(
-                                    TangramPoseMapper.spriteKitAngle(fromRawAngle: TangramPoseMapper.rawAngle(from: target.transform)) + canonicalTarget
+                                    anchorPosition: anchorObs.position
                                 )
-                                let rotDiffDeg = abs(angleDifference(pieceFeature, targetFeature)) * 180 / .pi
-                                if posDist <= posRelax && rotDiffDeg <= rotRelaxDeg { okCount += 1 }
+                                if residual.posDist <= posRelax && residual.rotDiffDeg <= rotRelaxDeg { okCount += 1 }
                             }
                         }
                         bothRelaxed = (okCount == pairObs.count)
@@ -317,6 +258,7 @@ class TangramValidationEngine {
 
                     if bothStrict || bothRelaxed {
                         // Reuse existing mapping if very similar to avoid noisy re-commits
+                        var reused = false
                         if let existing = mappingService.mapping(for: groupId) {
                             let dTheta = abs(angleDifference(existing.rotationDelta, mapping.rotationDelta)) * 180 / .pi
                             let dTrans = hypot(existing.translationOffset.dx - mapping.translationOffset.dx,
@@ -327,61 +269,15 @@ class TangramValidationEngine {
                                 anchorPieceIds = Set(pairObs.map { $0.pieceId })
                                 anchorIds = anchorPieceIds
                                 groupMappingsOut[groupId] = existing
-                            } else {
-                                mainGroupId = groupId
-                                anchorPieceIds = Set(pairObs.map { $0.pieceId })
-                                anchorIds = anchorPieceIds
-                                var stable = mapping
-                                stable.version = max(mapping.version, 2) // mark as global mapping
-                                stable.pairCount = max(mapping.pairCount, 2)
-                                groupMappingsOut[groupId] = stable
-                                mappingService.setMapping(for: groupId, mapping: stable)
-                                for (pid, st) in localStates {
-                                    pieceStates[pid] = st
-                                    if let tid = st.targetId {
-                                        pieceBindings[pid] = tid
-                                        validatedTargets.insert(tid)
-                                    }
-                                }
-                                #if DEBUG
-                                let deg = mapping.rotationDelta * 180 / .pi
-                                print("[ANCHOR] Committed group=\(groupId) theta=\(Int(deg))° pieces=\(pair.0.pieceId),\(pair.1.pieceId) mode=\(bothStrict ? "strict" : "relaxed")")
-                                for obs in pairObs {
-                                    if let st = localStates[obs.pieceId], let tid = st.targetId,
-                                       let target = puzzle.targetPieces.first(where: { $0.id == tid }) {
-                                        let mapped = mappingService.mapPieceToTargetSpace(
-                                            piecePositionScene: obs.position,
-                                            pieceRotation: obs.rotation,
-                                            pieceIsFlipped: obs.isFlipped,
-                                            mapping: mapping,
-                                            anchorPositionScene: anchorObs.position
-                                        )
-                                        let verts = TangramBounds.computeSKTransformedVertices(for: target)
-                                        let centroid = CGPoint(
-                                            x: verts.map { $0.x }.reduce(0, +) / CGFloat(max(1, verts.count)),
-                                            y: verts.map { $0.y }.reduce(0, +) / CGFloat(max(1, verts.count))
-                                        )
-                                        let posDist = hypot(mapped.positionSK.x - centroid.x, mapped.positionSK.y - centroid.y)
-                                        let canonicalPiece: CGFloat = obs.pieceType.isTriangle ? (3 * .pi / 4) : 0
-                                        let canonicalTarget: CGFloat = obs.pieceType.isTriangle ? (.pi / 4) : 0
-                                        let pieceFeature = TangramRotationValidator.normalizeAngle(
-                                            mapped.rotationSK + (mapped.isFlipped ? -canonicalPiece : canonicalPiece)
-                                        )
-                                        let targetFeature = TangramRotationValidator.normalizeAngle(
-                                            TangramPoseMapper.spriteKitAngle(fromRawAngle: TangramPoseMapper.rawAngle(from: target.transform)) + canonicalTarget
-                                        )
-                                        let rotDiffDeg = abs(angleDifference(pieceFeature, targetFeature)) * 180 / .pi
-                                        print("[VALIDATION-DETAIL] piece=\(obs.pieceId) target=\(tid) posDist=\(Int(posDist)) rotDiff=\(Int(rotDiffDeg))°")
-                                    }
-                                }
-                                #endif
+                                reused = true
                             }
-                        } else {
+                        }
+                        if !reused {
                             mainGroupId = groupId
                             anchorPieceIds = Set(pairObs.map { $0.pieceId })
                             anchorIds = anchorPieceIds
                             var stable = mapping
-                            stable.version = max(mapping.version, 2)
+                            stable.version = max(mapping.version, 2) // mark as global mapping
                             stable.pairCount = max(mapping.pairCount, 2)
                             groupMappingsOut[groupId] = stable
                             mappingService.setMapping(for: groupId, mapping: stable)
@@ -396,31 +292,9 @@ class TangramValidationEngine {
                             let deg = mapping.rotationDelta * 180 / .pi
                             print("[ANCHOR] Committed group=\(groupId) theta=\(Int(deg))° pieces=\(pair.0.pieceId),\(pair.1.pieceId) mode=\(bothStrict ? "strict" : "relaxed")")
                             for obs in pairObs {
-                                if let st = localStates[obs.pieceId], let tid = st.targetId,
-                                   let target = puzzle.targetPieces.first(where: { $0.id == tid }) {
-                                    let mapped = mappingService.mapPieceToTargetSpace(
-                                        piecePositionScene: obs.position,
-                                        pieceRotation: obs.rotation,
-                                        pieceIsFlipped: obs.isFlipped,
-                                        mapping: mapping,
-                                        anchorPositionScene: anchorObs.position
-                                    )
-                                    let verts = TangramBounds.computeSKTransformedVertices(for: target)
-                                    let centroid = CGPoint(
-                                        x: verts.map { $0.x }.reduce(0, +) / CGFloat(max(1, verts.count)),
-                                        y: verts.map { $0.y }.reduce(0, +) / CGFloat(max(1, verts.count))
-                                    )
-                                    let posDist = hypot(mapped.positionSK.x - centroid.x, mapped.positionSK.y - centroid.y)
-                                    let canonicalPiece: CGFloat = obs.pieceType.isTriangle ? (3 * .pi / 4) : 0
-                                    let canonicalTarget: CGFloat = obs.pieceType.isTriangle ? (.pi / 4) : 0
-                                    let pieceFeature = TangramRotationValidator.normalizeAngle(
-                                        mapped.rotationSK + (mapped.isFlipped ? -canonicalPiece : canonicalPiece)
-                                    )
-                                    let targetFeature = TangramRotationValidator.normalizeAngle(
-                                        TangramPoseMapper.spriteKitAngle(fromRawAngle: TangramPoseMapper.rawAngle(from: target.transform)) + canonicalTarget
-                                    )
-                                    let rotDiffDeg = abs(angleDifference(pieceFeature, targetFeature)) * 180 / .pi
-                                    print("[VALIDATION-DETAIL] piece=\(obs.pieceId) target=\(tid) posDist=\(Int(posDist)) rotDiff=\(Int(rotDiffDeg))°")
+                                if let tid = localStates[obs.pieceId]?.targetId, let entry = index.entry(for: tid) {
+                                    let residual = mappedResiduals(observation: obs, entry: entry, mapping: mapping, anchorPosition: anchorObs.position)
+                                    print("[VALIDATION-DETAIL] piece=\(obs.pieceId) target=\(tid) posDist=\(Int(residual.posDist)) rotDiff=\(Int(residual.rotDiffDeg))°")
                                 }
                             }
                             #endif
@@ -437,30 +311,9 @@ class TangramValidationEngine {
                         for obs in pairObs {
                             if let st = localStates[obs.pieceId] {
                                 print("  - piece=\(obs.pieceId) valid=\(st.isValid) target=\(st.targetId ?? "nil")")
-                                if let tid = st.targetId, let target = puzzle.targetPieces.first(where: { $0.id == tid }) {
-                                    let mapped = mappingService.mapPieceToTargetSpace(
-                                        piecePositionScene: obs.position,
-                                        pieceRotation: obs.rotation,
-                                        pieceIsFlipped: obs.isFlipped,
-                                        mapping: mapping,
-                                        anchorPositionScene: anchorObs.position
-                                    )
-                                    let verts = TangramBounds.computeSKTransformedVertices(for: target)
-                                    let centroid = CGPoint(
-                                        x: verts.map { $0.x }.reduce(0, +) / CGFloat(max(1, verts.count)),
-                                        y: verts.map { $0.y }.reduce(0, +) / CGFloat(max(1, verts.count))
-                                    )
-                                    let posDist = hypot(mapped.positionSK.x - centroid.x, mapped.positionSK.y - centroid.y)
-                                    let canonicalPiece: CGFloat = obs.pieceType.isTriangle ? (3 * .pi / 4) : 0
-                                    let canonicalTarget: CGFloat = obs.pieceType.isTriangle ? (.pi / 4) : 0
-                                    let pieceFeature = TangramRotationValidator.normalizeAngle(
-                                        mapped.rotationSK + (mapped.isFlipped ? -canonicalPiece : canonicalPiece)
-                                    )
-                                    let targetFeature = TangramRotationValidator.normalizeAngle(
-                                        TangramPoseMapper.spriteKitAngle(fromRawAngle: TangramPoseMapper.rawAngle(from: target.transform)) + canonicalTarget
-                                    )
-                                    let rotDiffDeg = abs(angleDifference(pieceFeature, targetFeature)) * 180 / .pi
-                                    print("    · residuals posDist=\(Int(posDist)) rotDiff=\(Int(rotDiffDeg))°")
+                                if let tid = st.targetId, let entry = index.entry(for: tid) {
+                                    let residual = mappedResiduals(observation: obs, entry: entry, mapping: mapping, anchorPosition: anchorObs.position)
+                                    print("    · residuals posDist=\(Int(residual.posDist)) rotDiff=\(Int(residual.rotDiffDeg))°")
                                 }
                             }
                         }
@@ -476,17 +329,20 @@ class TangramValidationEngine {
             let anchorId = mapping.anchorPieceId
             let anchorObs: PieceObservation? = frame.first(where: { $0.pieceId == anchorId })
             if let anchorObs = anchorObs {
+                let tol = TangramGameConstants.Validation.tolerances(for: difficulty)
+                let posLimit = tol.position + invalidationSlackPosition
+                let rotLimit = tol.rotationDeg + invalidationSlackRotationDeg
                 for obs in frame {
                     // Evaluate all pieces including anchors for lock maintenance
                     let st = validateMappedPiece(
                         observation: obs,
                         mapping: mapping,
                         anchorPosition: anchorObs.position,
-                        puzzle: puzzle,
+                        index: index,
                         difficulty: difficulty
                     )
                     pieceStates[obs.pieceId] = st
-                    if let lock = lockedValidations[obs.pieceId], let target = puzzle.targetPieces.first(where: { $0.id == lock.targetId }) {
+                    if let lock = lockedValidations[obs.pieceId], let entry = index.entry(for: lock.targetId) {
                         // Check sustained violation beyond slack
                         let mapped = mappingService.mapPieceToTargetSpace(
                             piecePositionScene: obs.position,
@@ -495,39 +351,24 @@ class TangramValidationEngine {
                             mapping: mapping,
                             anchorPositionScene: anchorObs.position
                         )
-                        let targetPoly = TangramBounds.computeSKTransformedVertices(for: target)
-                        let centroid = CGPoint(
-                            x: targetPoly.map { $0.x }.reduce(0, +) / CGFloat(max(1, targetPoly.count)),
-                            y: targetPoly.map { $0.y }.reduce(0, +) / CGFloat(max(1, targetPoly.count))
-                        )
-                        let canonicalPiece: CGFloat = obs.pieceType.isTriangle ? (3 * .pi / 4) : 0
-                        let pieceFeature = TangramRotationValidator.normalizeAngle(mapped.rotationSK + (mapped.isFlipped ? -canonicalPiece : canonicalPiece))
-                        let targetRawAngle = TangramPoseMapper.rawAngle(from: target.transform)
-                        let targetRotationSK = TangramPoseMapper.spriteKitAngle(fromRawAngle: targetRawAngle)
-                        let canonicalTarget: CGFloat = obs.pieceType.isTriangle ? (.pi / 4) : 0
-                        let targetFeature = TangramRotationValidator.normalizeAngle(targetRotationSK + canonicalTarget)
-                        let posDist = hypot(mapped.positionSK.x - centroid.x, mapped.positionSK.y - centroid.y)
-                        let rotDiffDeg = abs(angleDifference(pieceFeature, targetFeature)) * 180 / .pi
-                        let tol = TangramGameConstants.Validation.tolerances(for: difficulty)
-                        let posLimit = tol.position + invalidationSlackPosition
-                        let rotLimit = tol.rotationDeg + invalidationSlackRotationDeg
-                        if posDist <= posLimit && rotDiffDeg <= rotLimit {
+                        let residual = residuals(mapped: mapped, pieceType: obs.pieceType, entry: entry)
+                        if residual.posDist <= posLimit && residual.rotDiffDeg <= rotLimit {
                             // Refresh lock
                             lockedValidations[obs.pieceId]?.lastValidPose = (mapped.positionSK, mapped.rotationSK, mapped.isFlipped)
                             invalidationStartAt.removeValue(forKey: obs.pieceId)
                             pieceBindings[obs.pieceId] = lock.targetId
-                            pieceStates[obs.pieceId] = PieceValidationState(pieceId: obs.pieceId, isValid: true, confidence: 1.0, targetId: lock.targetId, optimalTransform: target.transform)
+                            pieceStates[obs.pieceId] = PieceValidationState(pieceId: obs.pieceId, isValid: true, confidence: 1.0, targetId: lock.targetId, optimalTransform: entry.target.transform)
                         } else {
                             let now = CACurrentMediaTime()
                             if invalidationStartAt[obs.pieceId] == nil {
                                 invalidationStartAt[obs.pieceId] = now
                                 // Keep valid during dwell
                                 pieceBindings[obs.pieceId] = lock.targetId
-                                pieceStates[obs.pieceId] = PieceValidationState(pieceId: obs.pieceId, isValid: true, confidence: 0.9, targetId: lock.targetId, optimalTransform: target.transform)
+                                pieceStates[obs.pieceId] = PieceValidationState(pieceId: obs.pieceId, isValid: true, confidence: 0.9, targetId: lock.targetId, optimalTransform: entry.target.transform)
                             } else if let start = invalidationStartAt[obs.pieceId], (now - start) < invalidationDwellSeconds {
                                 // Still dwelling: keep valid
                                 pieceBindings[obs.pieceId] = lock.targetId
-                                pieceStates[obs.pieceId] = PieceValidationState(pieceId: obs.pieceId, isValid: true, confidence: 0.85, targetId: lock.targetId, optimalTransform: target.transform)
+                                pieceStates[obs.pieceId] = PieceValidationState(pieceId: obs.pieceId, isValid: true, confidence: 0.85, targetId: lock.targetId, optimalTransform: entry.target.transform)
                             } else {
                                 // Dwell exceeded: unlock
                                 lockedValidations.removeValue(forKey: obs.pieceId)
@@ -557,60 +398,57 @@ class TangramValidationEngine {
                 }
                 groupMappingsOut[gid] = mapping
                 anchorIds = anchorPieceIds
+
+                // Assignment-free progress: union of every mapped piece against the silhouette
+                let mappedPolygons = frame.map { obs -> [CGPoint] in
+                    let mapped = mappingService.mapPieceToTargetSpace(
+                        piecePositionScene: obs.position,
+                        pieceRotation: obs.rotation,
+                        pieceIsFlipped: obs.isFlipped,
+                        mapping: mapping,
+                        anchorPositionScene: anchorObs.position
+                    )
+                    return TangramSilhouetteCoverage.piecePolygon(
+                        pieceType: obs.pieceType,
+                        position: mapped.positionSK,
+                        rotation: mapped.rotationSK,
+                        isFlipped: mapped.isFlipped
+                    )
+                }
+                coverageScore = silhouetteCoverage(for: puzzle).score(polygons: mappedPolygons)
             }
         }
         
         for obs in significant {
-            // Candidates by type
-            let candidates = puzzle.targetPieces.filter { $0.pieceType == obs.pieceType }
-            guard !candidates.isEmpty else { continue }
-            
             // Compute piece feature angle (no mapping, rotation-only)
-            let canonicalPiece: CGFloat = obs.pieceType.isTriangle ? (3 * .pi / 4) : 0
-            let pieceFeature = TangramRotationValidator.normalizeAngle(
-                obs.rotation + (obs.isFlipped ? -canonicalPiece : canonicalPiece)
+            let pieceFeature = TangramTargetFeatureIndex.pieceFeatureAngle(
+                rotation: obs.rotation,
+                isFlipped: obs.isFlipped,
+                pieceType: obs.pieceType
             )
             
-            // Pick best target by minimal rotation delta with symmetry awareness (square: 4-fold, etc.)
-            var best: (id: String, rotDeg: CGFloat, targetFeature: CGFloat, targetIsFlipped: Bool)?
-            for t in candidates {
-                let raw = TangramPoseMapper.rawAngle(from: t.transform)
-                let targRot = TangramPoseMapper.spriteKitAngle(fromRawAngle: raw)
-                let canonicalTarget: CGFloat = obs.pieceType.isTriangle ? (.pi / 4) : 0
-                let targetFeature = TangramRotationValidator.normalizeAngle(targRot + canonicalTarget)
-                let symDiff = TangramRotationValidator.rotationDifferenceToNearest(
-                    currentRotation: pieceFeature,
-                    targetRotation: targetFeature,
-                    pieceType: obs.pieceType,
-                    isFlipped: obs.isFlipped
-                )
-                let delta = abs(symDiff) * 180 / .pi
-                let det = t.transform.a * t.transform.d - t.transform.b * t.transform.c
-                let targFlipped = det < 0
+            // Pick best target by minimal symmetry-reduced rotation delta (square: 4-fold, etc.)
+            var best: (entry: TangramTargetFeatureIndex.Entry, rotDeg: CGFloat)?
+            for entry in index.candidates(for: obs.pieceType) {
+                let delta = abs(TangramTargetFeatureIndex.symmetricDelta(pieceFeature: pieceFeature, entry: entry)) * 180 / .pi
                 if best == nil || delta < best!.rotDeg {
-                    best = (t.id, delta, targetFeature, targFlipped)
+                    best = (entry, delta)
                 }
             }
             guard let picked = best else { continue }
-            let flipOK = (obs.pieceType != .parallelogram) || (obs.isFlipped != picked.targetIsFlipped)
+            let flipOK = (obs.pieceType != .parallelogram) || (obs.isFlipped != picked.entry.isFlipped)
             
             // Log minimal info per moved piece
             #if DEBUG
             let pieceDeg = obs.rotation * 180 / .pi
-            let targDeg = picked.targetFeature * 180 / .pi
-            print("[ORIENT] piece=\(obs.pieceId) type=\(obs.pieceType.rawValue) pieceRot=\(Int(pieceDeg))° targetRot=\(Int(targDeg))° delta=\(Int(picked.rotDeg))° flipOk=\(flipOK) target=\(picked.id)")
+            let targDeg = picked.entry.featureAngle * 180 / .pi
+            print("[ORIENT] piece=\(obs.pieceId) type=\(obs.pieceType.rawValue) pieceRot=\(Int(pieceDeg))° targetRot=\(Int(targDeg))° delta=\(Int(picked.rotDeg))° flipOk=\(flipOK) target=\(picked.entry.id)")
             #endif
             
             // 40% display in future on silhouette; for now we only use it to decide nudges
-            let rotOK = TangramRotationValidator.isRotationValid(
-                currentRotation: pieceFeature,
-                targetRotation: picked.targetFeature,
-                pieceType: obs.pieceType,
-                isFlipped: obs.isFlipped,
-                toleranceDegrees: options.orientationToleranceDeg
-            )
+            let rotOK = picked.rotDeg < options.orientationToleranceDeg
             if rotOK && flipOK {
-                orientedTargets.insert(picked.id)
+                orientedTargets.insert(picked.entry.id)
                 // Positive reinforcement unless already validated as part of anchor
                 if pieceStates[obs.pieceId]?.isValid != true {
                     pieceNudges[obs.pieceId] = NudgeContent(level: .gentle, message: "✅ Good job!", visualHint: .pulse(intensity: 0.4), duration: 1.2)
@@ -618,17 +456,14 @@ class TangramValidationEngine {
             } else if obs.pieceType == .parallelogram && !flipOK {
                 pieceNudges[obs.pieceId] = NudgeContent(level: .specific, message: "🔁 Try flipping", visualHint: .flipDemo, duration: 2.0)
                 #if DEBUG
-                print("[NUDGE] flip piece=\(obs.pieceId) target=\(picked.id)")
+                print("[NUDGE] flip piece=\(obs.pieceId) target=\(picked.entry.id)")
                 #endif
             } else if picked.rotDeg > options.orientationToleranceDeg && picked.rotDeg < options.rotationNudgeUpperDeg {
                 // Compute target node zRotation that satisfies feature-angle equality
-                // targetNodeZ = targetExpectedZ + canonicalTarget - sign(canonicalPiece)
-                let raw = TangramPoseMapper.rawAngle(from: puzzle.targetPieces.first { $0.id == picked.id }?.transform ?? .identity)
-                let targetExpectedZ = TangramPoseMapper.spriteKitAngle(fromRawAngle: raw)
-                let canonicalTarget: CGFloat = obs.pieceType.isTriangle ? (.pi / 4) : 0
+                // targetNodeZ = targetFeature - sign(canonicalPiece)
                 let canonicalPiece: CGFloat = obs.pieceType.isTriangle ? (3 * .pi / 4) : 0
                 let signAdjustedCanonicalPiece: CGFloat = obs.isFlipped ? -canonicalPiece : canonicalPiece
-                let desiredNodeZ = TangramRotationValidator.normalizeAngle(targetExpectedZ + canonicalTarget - signAdjustedCanonicalPiece)
+                let desiredNodeZ = TangramRotationValidator.normalizeAngle(picked.entry.featureAngle - signAdjustedCanonicalPiece)
 
                 // Emit rotation demo visual hint (animate current → target orientation)
                 pieceNudges[obs.pieceId] = NudgeContent(
@@ -638,7 +473,7 @@ class TangramValidationEngine {
                     duration: 2.0
                 )
                 #if DEBUG
-                print("[NUDGE] rotate-demo piece=\(obs.pieceId) delta=\(Int(picked.rotDeg))° target=\(picked.id) currZ=\(Int(obs.rotation * 180 / .pi))° desiredZ=\(Int(desiredNodeZ * 180 / .pi))°")
+                print("[NUDGE] rotate-demo piece=\(obs.pieceId) delta=\(Int(picked.rotDeg))° target=\(picked.entry.id) currZ=\(Int(obs.rotation * 180 / .pi))° desiredZ=\(Int(desiredNodeZ * 180 / .pi))°")
                 #endif
             }
         }
@@ -660,7 +495,8 @@ class TangramValidationEngine {
             groupMappings: groupMappingsOut,
             failureReasons: failureReasons,
             orientedTargets: orientedTargets,
-            anchorPieceIds: anchorIds
+            anchorPieceIds: anchorIds,
+            silhouetteCoverage: coverageScore
         )
     }
 
@@ -719,14 +555,9 @@ class TangramValidationEngine {
         observation: PieceObservation,
         mapping: AnchorMapping,
         anchorPosition: CGPoint,
-        puzzle: GamePuzzleData,
+        index: TangramTargetFeatureIndex,
         difficulty: UserPreferences.DifficultySetting
     ) -> PieceValidationState {
-        // Build candidate targets by type
-        let candidateTargets: [GamePuzzleData.TargetPiece] = puzzle.targetPieces.filter { target in
-            target.pieceType == observation.pieceType && !validatedTargets.contains(target.id)
-        }
-
         // Map the observed piece pose into target (SK) space using the group's mapping
         let mapped = mappingService.mapPieceToTargetSpace(
             piecePositionScene: observation.position,
@@ -737,10 +568,12 @@ class TangramValidationEngine {
         )
 
         // Precompute piece feature angle using mapped rotation and mapped flip
-        let canonicalPiece: CGFloat = observation.pieceType.isTriangle ? (3 * .pi / 4) : 0
-        let pieceFeatureAngle = TangramRotationValidator.normalizeAngle(
-            mapped.rotationSK + (mapped.isFlipped ? -canonicalPiece : canonicalPiece)
+        let pieceFeatureAngle = TangramTargetFeatureIndex.pieceFeatureAngle(
+            rotation: mapped.rotationSK,
+            isFlipped: mapped.isFlipped,
+            pieceType: observation.pieceType
         )
+        let tolerances = TangramGameConstants.Validation.tolerances(for: difficulty)
 
         var bestTargetId: String?
         var bestValid: Bool = false
@@ -748,38 +581,27 @@ class TangramValidationEngine {
         var bestTransform: CGAffineTransform?
         var bestCost: CGFloat = .infinity
 
-        for target in candidateTargets {
-            // Target centroid and rotation in SK space
-            let targetPoly = TangramBounds.computeSKTransformedVertices(for: target)
-            let targetCentroid = CGPoint(
-                x: targetPoly.map { $0.x }.reduce(0, +) / CGFloat(max(1, targetPoly.count)),
-                y: targetPoly.map { $0.y }.reduce(0, +) / CGFloat(max(1, targetPoly.count))
-            )
-            let targetRawAngle = TangramPoseMapper.rawAngle(from: target.transform)
-            let targetRotationSK = TangramPoseMapper.spriteKitAngle(fromRawAngle: targetRawAngle)
-            let canonicalTarget: CGFloat = observation.pieceType.isTriangle ? (.pi / 4) : 0
-            let targetFeatureAngle = TangramRotationValidator.normalizeAngle(targetRotationSK + canonicalTarget)
-
-            // Validate using mapped piece pose vs target centroid and feature angles
+        // Candidate targets by type, excluding already validated ones
+        for entry in index.candidates(for: observation.pieceType) where !validatedTargets.contains(entry.id) {
+            // Validate using mapped piece pose vs precomputed target centroid and feature angle
             let resultTuple = validator.validateForSpriteKitWithFeatures(
                 piecePosition: mapped.positionSK,
                 pieceFeatureAngle: pieceFeatureAngle,
-                targetFeatureAngle: targetFeatureAngle,
+                targetFeatureAngle: entry.featureAngle,
                 pieceType: observation.pieceType,
                 isFlipped: mapped.isFlipped,
-                targetTransform: target.transform,
-                targetWorldPos: targetCentroid
+                targetTransform: entry.target.transform,
+                targetWorldPos: entry.centroidSK
             )
 
             // Confidence based on residuals in mapped space
-            let posDist = hypot(mapped.positionSK.x - targetCentroid.x, mapped.positionSK.y - targetCentroid.y)
-            let rotDiff = angleDifference(pieceFeatureAngle, targetFeatureAngle)
+            let posDist = hypot(mapped.positionSK.x - entry.centroidSK.x, mapped.positionSK.y - entry.centroidSK.y)
+            let rotDiff = angleDifference(pieceFeatureAngle, entry.featureAngle)
             let posConf = max(0, 1 - posDist / 100)
             let rotConf = max(0, 1 - abs(rotDiff) / .pi)
             let conf = (posConf + rotConf) / 2
 
             // Combine into a cost (lower is better)
-            let tolerances = TangramGameConstants.Validation.tolerances(for: difficulty)
             let cost = posDist / max(1, tolerances.position) + (abs(rotDiff) / max(0.0001, tolerances.rotationDeg * .pi / 180))
 
             let isValid = resultTuple.positionValid && resultTuple.rotationValid && resultTuple.flipValid
@@ -788,16 +610,16 @@ class TangramValidationEngine {
                     bestCost = cost
                     bestValid = true
                     bestConfidence = conf
-                    bestTargetId = target.id
-                    bestTransform = target.transform
+                    bestTargetId = entry.id
+                    bestTransform = entry.target.transform
                 }
             } else if !bestValid {
                 // Track best non-valid for potential feedback
                 if cost < bestCost {
                     bestCost = cost
                     bestConfidence = conf
-                    bestTargetId = target.id
-                    bestTransform = target.transform
+                    bestTargetId = entry.id
+                    bestTransform = entry.target.transform
                 }
             }
         }
@@ -810,6 +632,38 @@ class TangramValidationEngine {
             optimalTransform: bestTransform
         )
     }
+
+    /// Position and raw feature-angle residuals of an observation mapped into target space
+    private func mappedResiduals(
+        observation: PieceObservation,
+        entry: TangramTargetFeatureIndex.Entry,
+        mapping: AnchorMapping,
+        anchorPosition: CGPoint
+    ) -> (posDist: CGFloat, rotDiffDeg: CGFloat) {
+        let mapped = mappingService.mapPieceToTargetSpace(
+            piecePositionScene: observation.position,
+            pieceRotation: observation.rotation,
+            pieceIsFlipped: observation.isFlipped,
+            mapping: mapping,
+            anchorPositionScene: anchorPosition
+        )
+        return residuals(mapped: mapped, pieceType: observation.pieceType, entry: entry)
+    }
+
+    private func residuals(
+        mapped: (positionSK: CGPoint, rotationSK: CGFloat, isFlipped: Bool),
+        pieceType: TangramPieceType,
+        entry: TangramTargetFeatureIndex.Entry
+    ) -> (posDist: CGFloat, rotDiffDeg: CGFloat) {
+        let pieceFeature = TangramTargetFeatureIndex.pieceFeatureAngle(
+            rotation: mapped.rotationSK,
+            isFlipped: mapped.isFlipped,
+            pieceType: pieceType
+        )
+        let posDist = hypot(mapped.positionSK.x - entry.centroidSK.x, mapped.positionSK.y - entry.centroidSK.y)
+        let rotDiffDeg = abs(angleDifference(pieceFeature, entry.featureAngle)) * 180 / .pi
+        return (posDist, rotDiffDeg)
+    }
     
     
     // MARK: - Failure Analysis
@@ -911,26 +765,55 @@ class TangramValidationEngine {
         return diff
     }
 
+    /// Returns the cached target feature table, rebuilding it only when the puzzle changes
+    private func targetFeatureIndex(for puzzle: GamePuzzleData) -> TangramTargetFeatureIndex {
+        if let cached = targetIndex, cached.matches(puzzle) {
+            return cached
+        }
+        let index = TangramTargetFeatureIndex(puzzle: puzzle)
+        targetIndex = index
+        return index
+    }
+
+    private func silhouetteCoverage(for puzzle: GamePuzzleData) -> TangramSilhouetteCoverage {
+        if let cached = coverageModel, cached.matches(puzzle) {
+            return cached
+        }
+        let model = TangramSilhouetteCoverage(puzzle: puzzle)
+        coverageModel = model
+        return model
+    }
+
+    /// Closest pair of observations by scene distance, or nil when fewer than two are given
+    private func closestPair(in observations: [PieceObservation]) -> (PieceObservation, PieceObservation)? {
+        guard observations.count >= 2 else { return nil }
+        var bestPair: (PieceObservation, PieceObservation)? = nil
+        var bestDist: CGFloat = .infinity
+        for i in 0..<(observations.count - 1) {
+            for j in (i + 1)..<observations.count {
+                let p = observations[i].position
+                let q = observations[j].position
+                let d = hypot(p.x - q.x, p.y - q.y)
+                if d < bestDist { bestDist = d; bestPair = (observations[i], observations[j]) }
+            }
+        }
+        return bestPair
+    }
+
     // MARK: - Pair Mapping per plan doc (centroid + relative)
     private func computePairDocMapping(
         pair: (TangramValidationEngine.PieceObservation, TangramValidationEngine.PieceObservation),
-        puzzle: GamePuzzleData
+        index: TangramTargetFeatureIndex
     ) -> AnchorMapping? {
         let p0 = pair.0
         let p1 = pair.1
-        guard let t0 = puzzle.targetPieces.first(where: { $0.pieceType == p0.pieceType }),
-              let t1 = puzzle.targetPieces.first(where: { $0.pieceType == p1.pieceType }) else {
+        guard let t0 = index.candidates(for: p0.pieceType).first,
+              let t1 = index.candidates(for: p1.pieceType).first else {
             return nil
         }
-        // Compute target centroids in SK space
-        func centroid(of verts: [CGPoint]) -> CGPoint {
-            guard !verts.isEmpty else { return .zero }
-            let sx = verts.reduce(0) { $0 + $1.x }
-            let sy = verts.reduce(0) { $0 + $1.y }
-            return CGPoint(x: sx / CGFloat(verts.count), y: sy / CGFloat(verts.count))
-        }
-        let c0 = centroid(of: TangramBounds.computeSKTransformedVertices(for: t0))
-        let c1 = centroid(of: TangramBounds.computeSKTransformedVertices(for: t1))
+        // Target centroids in SK space (precomputed per puzzle)
+        let c0 = t0.centroidSK
+        let c1 = t1.centroidSK
         // Pair centroids
         let Cp = CGPoint(x: (p0.position.x + p1.position.x) / 2, y: (p0.position.y + p1.position.y) / 2)
         let Ct = CGPoint(x: (c0.x + c1.x) / 2, y: (c0.y + c1.y) / 2)
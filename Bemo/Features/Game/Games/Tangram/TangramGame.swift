@@ -149,8 +149,8 @@ class TangramGame: Game {
             print("  📦 \(piece.pieceTypeId): pos=(\(String(format: "%.3f", piece.position.x)), \(String(format: "%.3f", piece.position.y)))")
         }
         
-        // Convert CV pieces directly to PlacedPieces (no color mapping needed)
-        let placedPieces = pieces.map { PlacedPiece(from: $0) }
+        // Convert CV pieces directly to PlacedPieces (no color mapping needed); held pieces are not placed
+        let placedPieces = pieces.filter { !$0.isLifted }.map { PlacedPiece(from: $0) }
         
         // Pass to view model for processing
         viewModel?.processCVInput(placedPieces)
@@ -74,41 +74,38 @@ enum TangramGeometryUtilities {
             guard poly.count >= 2 else { return [] }
             return (0..<poly.count).map { i in (poly[i], poly[(i+1) % poly.count]) }
         }
-        func segmentDistance(_ p1: CGPoint, _ p2: CGPoint, _ p3: CGPoint, _ p4: CGPoint) -> CGFloat {
-            let u = CGVector(dx: p2.x - p1.x, dy: p2.y - p1.y)
-            let v = CGVector(dx: p4.x - p3.x, dy: p4.y - p3.y)
-            let w = CGVector(dx: p1.x - p3.x, dy: p1.y - p3.y)
-            let a = u.dx*u.dx + u.dy*u.dy
-            let b = u.dx*v.dx + u.dy*v.dy
-            let c = v.dx*v.dx + v.dy*v.dy
-            let d = u.dx*w.dx + u.dy*w.dy
-            let e = v.dx*w.dx + v.dy*w.dy
-            let denom = a*c - b*b
-            var sc: CGFloat = 0
-            var tc: CGFloat = 0
-            func clamp(_ x: CGFloat, _ lo: CGFloat, _ hi: CGFloat) -> CGFloat { max(lo, min(hi, x)) }
-            if denom < 1e-6 {
-                sc = 0
-                tc = clamp(e/c, 0, 1)
-            } else {
-                sc = clamp((b*e - c*d)/denom, 0, 1)
-                tc = clamp((a*e - b*d)/denom, 0, 1)
-            }
-            let dpx = w.dx + sc*u.dx - tc*v.dx
-            let dpy = w.dy + sc*u.dy - tc*v.dy
-            return hypot(dpx, dpy)
-        }
         let ea = edges(a)
         let eb = edges(b)
         var minDist: CGFloat = .greatestFiniteMagnitude
         for (a0, a1) in ea { for (b0, b1) in eb {
-            let d = segmentDistance(a0, a1, b0, b1)
+            let d = Self.segmentDistance(a0, a1, b0, b1)
             if d < minDist { minDist = d }
             if minDist == 0 { return 0 }
         }}
         return minDist
     }
     
+    /// Minimum distance between segments p1–p2 and p3–p4: zero when they cross, otherwise the
+    /// closest pair always includes an endpoint (this also covers parallel segments)
+    static func segmentDistance(_ p1: CGPoint, _ p2: CGPoint, _ p3: CGPoint, _ p4: CGPoint) -> CGFloat {
+        func cross(_ o: CGPoint, _ a: CGPoint, _ b: CGPoint) -> CGFloat {
+            (a.x - o.x) * (b.y - o.y) - (a.y - o.y) * (b.x - o.x)
+        }
+        func pointDistance(_ p: CGPoint, _ s0: CGPoint, _ s1: CGPoint) -> CGFloat {
+            let sx = s1.x - s0.x, sy = s1.y - s0.y
+            let lengthSquared = sx*sx + sy*sy
+            let t = lengthSquared > 0 ? max(0, min(1, ((p.x - s0.x)*sx + (p.y - s0.y)*sy) / lengthSquared)) : 0
+            return hypot(p.x - (s0.x + t*sx), p.y - (s0.y + t*sy))
+        }
+        let d1 = cross(p3, p4, p1), d2 = cross(p3, p4, p2)
+        let d3 = cross(p1, p2, p3), d4 = cross(p1, p2, p4)
+        if ((d1 > 0 && d2 < 0) || (d1 < 0 && d2 > 0)) && ((d3 > 0 && d4 < 0) || (d3 < 0 && d4 > 0)) {
+            return 0
+        }
+        return min(pointDistance(p1, p3, p4), pointDistance(p2, p3, p4),
+                   pointDistance(p3, p1, p2), pointDistance(p4, p1, p2))
+    }
+    
     /// Extracts rotation angle for SpriteKit scene space (negated to account for Y-flip in target rendering)
     /// This converts from the stored transform's rotation to the scene's coordinate space
     /// where target silhouettes are rendered with Y inverted
@@ -0,0 +1,334 @@
+//
+//  TangramSilhouetteRasterizer.swift
+//  Bemo
+//
+//  Anti-aliased scanline rasterizer for puzzle polygons
+//
+
+// WHAT: Exact-area coverage masks for sets of polygons, coverage IoU, and off-main-thread PNG thumbnails
+// ARCHITECTURE: Utility shared by PuzzlePersistenceService (thumbnails) and silhouette coverage scoring
+// USAGE: rasterize(_:width:height:transform:) for a mask, coverageIoU(_:_:) to compare, pngThumbnails(_:size:scale:) to batch render
+
+import Foundation
+import CoreGraphics
+import UIKit
+
+// MARK: - Coverage Mask
+
+/// Per-pixel covered area in [0, 1], row-major
+struct TangramCoverageMask {
+    let width: Int
+    let height: Int
+    let values: [Float]
+
+    /// Covered area in pixels
+    var area: Double {
+        values.reduce(0) { $0 + Double($1) }
+    }
+
+    /// Soft intersection-over-union (Σmin / Σmax); 1 for identical masks, 0 when disjoint or both empty
+    func intersectionOverUnion(with other: TangramCoverageMask) -> Double {
+        guard width == other.width, height == other.height else { return 0 }
+        var intersection = 0.0
+        var union = 0.0
+        for i in values.indices {
+            intersection += Double(min(values[i], other.values[i]))
+            union += Double(max(values[i], other.values[i]))
+        }
+        return union > 0 ? intersection / union : 0
+    }
+}
+
+// MARK: - Rasterizer
+
+/// Signed-area accumulation rasterizer: each edge deposits its exact trapezoid coverage into a
+/// per-row buffer and a prefix sum resolves the fill. Pieces that share an edge sum to full
+/// coverage along it, so tiled silhouettes have no anti-aliasing seams.
+enum TangramSilhouetteRasterizer {
+
+    // MARK: - Types
+
+    struct Color {
+        let red: Float
+        let green: Float
+        let blue: Float
+        let alpha: Float
+
+        static let white = Color(red: 1, green: 1, blue: 1, alpha: 1)
+        static let black = Color(red: 0, green: 0, blue: 0, alpha: 1)
+    }
+
+    /// Polygons drawn with one fill color, optionally stroked along each polygon's boundary
+    struct Layer {
+        let polygons: [[CGPoint]]
+        let color: Color
+        var outline: Color? = nil
+    }
+
+    // MARK: - Coverage
+
+    /// Coverage of the union of `polygons` after `transform`, in a width × height pixel grid.
+    /// Polygons may use either winding; overlapping polygons saturate at 1.
+    static func rasterize(
+        _ polygons: [[CGPoint]],
+        width: Int,
+        height: Int,
+        transform: CGAffineTransform = .identity
+    ) -> TangramCoverageMask {
+        guard width > 0, height > 0 else {
+            return TangramCoverageMask(width: max(width, 0), height: max(height, 0), values: [])
+        }
+        let stride = width + 2
+        var accumulation = [Float](repeating: 0, count: stride * height)
+
+        accumulation.withUnsafeMutableBufferPointer { buffer in
+            for polygon in polygons where polygon.count > 2 {
+                var points = polygon.map { $0.applying(transform) }
+                // Normalize winding so overlapping polygons add instead of cancelling
+                if signedArea(points) < 0 { points.reverse() }
+                for i in 0..<points.count {
+                    accumulateEdge(from: points[i], to: points[(i + 1) % points.count],
+                                   width: width, height: height, stride: stride, into: buffer)
+                }
+            }
+        }
+
+        var values = [Float](repeating: 0, count: width * height)
+        for y in 0..<height {
+            var sum: Float = 0
+            let row = y * stride
+            for x in 0..<width {
+                sum += accumulation[row + x]
+                values[y * width + x] = min(1, abs(sum))
+            }
+        }
+        return TangramCoverageMask(width: width, height: height, values: values)
+    }
+
+    /// Uniform scale + translation that centers `bounds` in `size`, filling `fill` of the smaller side
+    static func fitTransform(bounds: CGRect, into size: CGSize, fill: CGFloat = 0.8) -> CGAffineTransform {
+        guard bounds.width > 0 || bounds.height > 0, !bounds.isNull else { return .identity }
+        let scale = min(
+            bounds.width > 0 ? size.width * fill / bounds.width : .greatestFiniteMagnitude,
+            bounds.height > 0 ? size.height * fill / bounds.height : .greatestFiniteMagnitude
+        )
+        return CGAffineTransform(translationX: size.width / 2, y: size.height / 2)
+            .scaledBy(x: scale, y: scale)
+            .translatedBy(x: -bounds.midX, y: -bounds.midY)
+    }
+
+    /// Pixel-coverage IoU of two polygon sets in a shared frame framing both
+    static func coverageIoU(_ a: [[CGPoint]], _ b: [[CGPoint]], resolution: Int = 128) -> Double {
+        let bounds = Self.bounds(of: a + b)
+        guard !bounds.isNull else { return 0 }
+        let size = CGSize(width: resolution, height: resolution)
+        let transform = fitTransform(bounds: bounds, into: size, fill: 0.9)
+        let maskA = rasterize(a, width: resolution, height: resolution, transform: transform)
+        let maskB = rasterize(b, width: resolution, height: resolution, transform: transform)
+        return maskA.intersectionOverUnion(with: maskB)
+    }
+
+    static func bounds(of polygons: [[CGPoint]]) -> CGRect {
+        var minX = CGFloat.greatestFiniteMagnitude, minY = CGFloat.greatestFiniteMagnitude
+        var maxX = -CGFloat.greatestFiniteMagnitude, maxY = -CGFloat.greatestFiniteMagnitude
+        for point in polygons.joined() {
+            minX = min(minX, point.x); maxX = max(maxX, point.x)
+            minY = min(minY, point.y); maxY = max(maxY, point.y)
+        }
+        guard minX <= maxX else { return .null }
+        return CGRect(x: minX, y: minY, width: maxX - minX, height: maxY - minY)
+    }
+
+    // MARK: - Thumbnails
+
+    /// Composite layers (in order, source-over) onto a background, fitted into `size` points at `scale`.
+    /// Outlined layers get a band of `outlineWidth` points centered on each polygon edge, drawn over their fill.
+    static func renderImage(
+        layers: [Layer],
+        size: CGSize,
+        scale: CGFloat = 2,
+        background: Color = .white,
+        outlineWidth: CGFloat = 0.5
+    ) -> CGImage? {
+        let width = Int((size.width * scale).rounded())
+        let height = Int((size.height * scale).rounded())
+        guard width > 0, height > 0 else { return nil }
+
+        let transform = fitTransform(
+            bounds: bounds(of: layers.flatMap { $0.polygons }),
+            into: CGSize(width: width, height: height)
+        )
+
+        var red = [Float](repeating: background.red * background.alpha, count: width * height)
+        var green = [Float](repeating: background.green * background.alpha, count: width * height)
+        var blue = [Float](repeating: background.blue * background.alpha, count: width * height)
+        var alpha = [Float](repeating: background.alpha, count: width * height)
+
+        func composite(_ coverage: [Float], _ c: Color) {
+            for i in coverage.indices where coverage[i] > 0 {
+                let a = coverage[i] * c.alpha
+                red[i] = c.red * a + red[i] * (1 - a)
+                green[i] = c.green * a + green[i] * (1 - a)
+                blue[i] = c.blue * a + blue[i] * (1 - a)
+                alpha[i] = a + alpha[i] * (1 - a)
+            }
+        }
+
+        let halfStroke = outlineWidth * scale / 2
+        for layer in layers {
+            composite(rasterize(layer.polygons, width: width, height: height, transform: transform).values, layer.color)
+
+            guard let outline = layer.outline, halfStroke > 0 else { continue }
+            // Band between the outward and inward offsets of each (convex) piece
+            let placed = layer.polygons.filter { $0.count > 2 }.map { $0.map { $0.applying(transform) } }
+            let outer = rasterize(placed.map { offset($0, by: halfStroke) }, width: width, height: height)
+            let inner = rasterize(placed.map { offset($0, by: -halfStroke) }, width: width, height: height)
+            composite(zip(outer.values, inner.values).map { max(0, $0 - $1) }, outline)
+        }
+
+        var pixels = [UInt8](repeating: 0, count: width * height * 4)
+        for i in 0..<(width * height) {
+            pixels[i * 4] = UInt8((min(max(red[i], 0), 1) * 255).rounded())
+            pixels[i * 4 + 1] = UInt8((min(max(green[i], 0), 1) * 255).rounded())
+            pixels[i * 4 + 2] = UInt8((min(max(blue[i], 0), 1) * 255).rounded())
+            pixels[i * 4 + 3] = UInt8((min(max(alpha[i], 0), 1) * 255).rounded())
+        }
+
+        guard let provider = CGDataProvider(data: Data(pixels) as CFData) else { return nil }
+        return CGImage(
+            width: width,
+            height: height,
+            bitsPerComponent: 8,
+            bitsPerPixel: 32,
+            bytesPerRow: width * 4,
+            space: CGColorSpaceCreateDeviceRGB(),
+            bitmapInfo: CGBitmapInfo(rawValue: CGImageAlphaInfo.premultipliedLast.rawValue),
+            provider: provider,
+            decode: nil,
+            shouldInterpolate: false,
+            intent: .defaultIntent
+        )
+    }
+
+    /// Render many thumbnails concurrently off the main thread, keyed by id
+    static func pngThumbnails(
+        _ jobs: [(id: String, layers: [Layer])],
+        size: CGSize,
+        scale: CGFloat = 2
+    ) async -> [String: Data] {
+        await withTaskGroup(of: (String, Data?).self) { group in
+            for job in jobs {
+                group.addTask(priority: .utility) {
+                    let image = renderImage(layers: job.layers, size: size, scale: scale)
+                    return (job.id, image.flatMap { UIImage(cgImage: $0).pngData() })
+                }
+            }
+            var results: [String: Data] = [:]
+            for await (id, data) in group {
+                if let data { results[id] = data }
+            }
+            return results
+        }
+    }
+
+    // MARK: - Scanline Core
+
+    /// Convex polygon with every edge moved `distance` outward (negative moves inward)
+    private static func offset(_ polygon: [CGPoint], by distance: CGFloat) -> [CGPoint] {
+        let points = signedArea(polygon) < 0 ? Array(polygon.reversed()) : polygon
+        let normals: [CGVector] = points.indices.map { i in
+            let p = points[i], q = points[(i + 1) % points.count]
+            let length = hypot(q.x - p.x, q.y - p.y)
+            return length > 0 ? CGVector(dx: (q.y - p.y) / length, dy: -(q.x - p.x) / length) : CGVector(dx: 0, dy: 0)
+        }
+        return points.indices.map { i in
+            // The vertex moves along the bisector far enough that both adjacent edges move by `distance`
+            let n0 = normals[(i + points.count - 1) % points.count], n1 = normals[i]
+            let cosine = n0.dx * n1.dx + n0.dy * n1.dy
+            guard cosine > -0.99 else { return points[i] }
+            let k = distance / (1 + cosine)
+            return CGPoint(x: points[i].x + (n0.dx + n1.dx) * k, y: points[i].y + (n0.dy + n1.dy) * k)
+        }
+    }
+
+    private static func signedArea(_ points: [CGPoint]) -> CGFloat {
+        var sum: CGFloat = 0
+        for i in 0..<points.count {
+            let p = points[i], q = points[(i + 1) % points.count]
+            sum += p.x * q.y - q.x * p.y
+        }
+        return sum / 2
+    }
+
+    /// Deposit the exact area to the right of one edge, row by row. Each row's deposits
+    /// telescope to the edge's signed height, so the row prefix sum yields coverage.
+    private static func accumulateEdge(
+        from start: CGPoint,
+        to end: CGPoint,
+        width: Int,
+        height: Int,
+        stride: Int,
+        into buffer: UnsafeMutableBufferPointer<Float>
+    ) {
+        // Horizontal clamp keeps the crossing inside the row; area left of x = 0 folds onto column 0
+        var x0 = Float(min(max(start.x, 0), CGFloat(width)))
+        var y0 = Float(start.y)
+        var x1 = Float(min(max(end.x, 0), CGFloat(width)))
+        var y1 = Float(end.y)
+        guard y0 != y1 else { return }
+
+        var direction: Float = 1
+        if y0 > y1 {
+            swap(&x0, &x1)
+            swap(&y0, &y1)
+            direction = -1
+        }
+
+        let dxdy = (x1 - x0) / (y1 - y0)
+        var x = y0 < 0 ? x0 - y0 * dxdy : x0
+        let firstRow = max(0, Int(y0.rounded(.down)))
+        let lastRow = min(height, Int(y1.rounded(.up)))
+        guard firstRow < lastRow else { return }
+
+        for y in firstRow..<lastRow {
+            let row = y * stride
+            let dy = min(Float(y + 1), y1) - max(Float(y), y0)
+            let xNext = x + dxdy * dy
+            let d = dy * direction
+            let left = min(x, xNext), right = max(x, xNext)
+            let leftFloor = left.rounded(.down)
+            let leftIndex = Int(leftFloor)
+            let rightCeil = right.rounded(.up)
+            let rightIndex = Int(rightCeil)
+
+            if rightIndex <= leftIndex + 1 {
+                // Edge stays within one pixel column in this row
+                let midFraction = 0.5 * (x + xNext) - leftFloor
+                buffer[row + leftIndex] += d - d * midFraction
+                buffer[row + leftIndex + 1] += d * midFraction
+            } else {
+                // Edge spans several columns: triangle at each end, constant ramp between
+                let slope = 1 / (right - left)
+                let leftFraction = left - leftFloor
+                let firstArea = 0.5 * slope * (1 - leftFraction) * (1 - leftFraction)
+                let rightFraction = right - rightCeil + 1
+                let lastArea = 0.5 * slope * rightFraction * rightFraction
+
+                buffer[row + leftIndex] += d * firstArea
+                if rightIndex == leftIndex + 2 {
+                    buffer[row + leftIndex + 1] += d * (1 - firstArea - lastArea)
+                } else {
+                    let secondArea = slope * (1.5 - leftFraction)
+                    buffer[row + leftIndex + 1] += d * (secondArea - firstArea)
+                    for column in (leftIndex + 2)..<(rightIndex - 1) {
+                        buffer[row + column] += d * slope
+                    }
+                    let beforeLast = secondArea + Float(rightIndex - leftIndex - 3) * slope
+                    buffer[row + rightIndex - 1] += d * (1 - beforeLast - lastArea)
+                }
+                buffer[row + rightIndex] += d * lastArea
+            }
+            x = xNext
+        }
+    }
+}
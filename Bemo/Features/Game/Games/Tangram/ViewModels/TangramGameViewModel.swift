@@ -33,7 +33,11 @@ class TangramGameViewModel {
         case completed(allDifficulties: Bool)  // Completed some or all difficulties
     }
     
-    var currentPhase: GamePhase = .selectingDifficulty
+    var currentPhase: GamePhase = .selectingDifficulty {
+        didSet {
+            if currentPhase != oldValue { updateCVPowerCeiling() }
+        }
+    }
     var selectedPuzzle: GamePuzzleData?
     var gameState: PuzzleGameState?
     var score: Int = 0
@@ -126,6 +130,8 @@ class TangramGameViewModel {
     var availablePuzzles: [GamePuzzleData] = []
     private weak var cvService: CVService?
     private var cvCancellable: AnyCancellable?
+    /// Display-rate pose source for the scene's CV overlay
+    var cvPoseTimeline: CVPoseTimeline? { cvService?.poseTimeline }
     
     // Unified validation engine
     private var _validationEngine: TangramValidationEngine?
@@ -1292,6 +1298,7 @@ class TangramGameViewModel {
     
     func setCVService(_ service: CVService) {
         self.cvService = service
+        updateCVPowerCeiling()
         
         // Subscribe to CV detection results for overlay image
         cvCancellable = service.detectionResultsPublisher
@@ -1300,11 +1307,9 @@ class TangramGameViewModel {
                 self?.cvOverlayImage = result.overlayImage
                 self?.cvFPS = result.fps
                 // Store model polygons and colors for SpriteKit visualization
-                if let plane = result.tangramResult?.planeModelPolygons as? [NSNumber: [NSNumber]] {
-                    self?.modelPlanePolygons = plane
-                } else {
-                    self?.modelPlanePolygons = [:]
-                }
+                // Keyed by stable class id so swapped same-shape detections do not re-bind pieces;
+                // held pieces would otherwise match targets at their approximate projection
+                self?.modelPlanePolygons = result.planeModelPolygons.filter { !result.liftedPieces.contains($0.key.intValue) }
                if let colors = result.tangramResult?.modelColorsRGB as? [NSNumber: [NSNumber]] {
                     self?.modelColorsRGB = colors
                 } else {
@@ -1313,6 +1318,11 @@ class TangramGameViewModel {
             }
     }
 
+    /// Full CV power only while a puzzle is on screen; other phases keep the camera watching for motion
+    private func updateCVPowerCeiling() {
+        cvService?.setPowerCeiling(currentPhase == .playingPuzzle ? .full : .watch)
+    }
+
     // Propagate UI view size to CVService for accurate overlay composition
     func setCVServiceSize(_ size: CGSize) {
         cvService?.updateViewSize(size)
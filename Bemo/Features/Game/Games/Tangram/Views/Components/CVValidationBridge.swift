@@ -64,9 +64,19 @@ class CVValidationBridge {
         let now = CACurrentMediaTime()
         let timeSinceLastValidation = now - lastValidationTime
         
-        // If piece is moving (high velocity), use throttle; otherwise use placement delay
+        // If piece is moving (high velocity), use throttle; otherwise use placement delay.
+        // A CV pose whose match error plus uncertainty stays inside the tolerance needs no dwell at all.
         let isMoving = (piece.physicsBody?.velocity.length() ?? 0) > 10.0
-        let delay = isMoving ? validationThrottle : placementValidationDelay
+        let tolerances = TangramGameConstants.Validation.tolerances(for: scene.difficultySetting)
+        let poseSettled = piece.pieceType.map {
+            // Validation tolerances are in scene coordinates; the CV match is measured in panel points
+            scene.isCVPoseSettled(
+                $0,
+                positionTolerance: scene.sceneLengthToPanel(tolerances.position),
+                rotationToleranceDeg: tolerances.rotationDeg
+            )
+        } ?? false
+        let delay = poseSettled ? 0 : (isMoving ? validationThrottle : placementValidationDelay)
         
         if timeSinceLastValidation < delay {
             // Schedule validation after delay
@@ -385,8 +395,10 @@ class CVValidationBridge {
             scene.userData?["groupMapping_\(groupId)"] = mapping
         }
         
-        // Check for puzzle completion
-        if result.validatedTargets.count == scene.puzzle?.targetPieces.count {
+        // Check for puzzle completion: every target validated, or the silhouette is filled
+        // even when same-shape pieces could not be assigned one-to-one
+        if result.validatedTargets.count == scene.puzzle?.targetPieces.count ||
+            result.silhouetteCoverage?.isComplete == true {
             scene.onPuzzleCompleted?()
         }
     }
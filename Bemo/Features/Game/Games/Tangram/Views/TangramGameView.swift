@@ -491,6 +491,7 @@ struct TangramGameView: View {
                     cvFPS: viewModel.cvFPS,
                     modelPlanePolygons: viewModel.modelPlanePolygons,
                     modelColorsRGB: viewModel.modelColorsRGB,
+                    poseTimeline: viewModel.cvPoseTimeline,
                     onViewSizeChange: { size in
                         // Inform CVService to use the UI view size for overlays and homography projection
                         viewModel.setCVServiceSize(size)
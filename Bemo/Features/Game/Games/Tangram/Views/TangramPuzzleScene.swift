@@ -56,6 +56,8 @@ class TangramPuzzleScene: SKScene {
     // MARK: - Services
     
     internal let eventBus = CVEventBus.shared  // Internal for extensions
+    /// Display-rate pose source; when set, CV overlay shapes are re-posed every rendered frame
+    var poseTimeline: CVPoseTimeline?
     internal var eventSubscriptionId: UUID?  // Internal for extensions
     internal var frameSubscriptionId: UUID?  // Internal for extensions
     internal let validator = TangramPieceValidator()  // Internal for extensions
@@ -117,6 +119,8 @@ class TangramPuzzleScene: SKScene {
     private var snapHoldUntilByTargetId: [String: TimeInterval] = [:]
     private var lastMatchedGlobalIndexByTargetId: [String: Int] = [:]
     private let snapHoldDuration: TimeInterval = 1.0
+    // Match error (panel points / degrees) of each piece type in the latest verification pass
+    private var cvMatchMetricsByPieceType: [TangramPieceType: TangramPieceMatchMetrics] = [:]
     // Completion wiring to ViewModel
     private var firedCompletionTargetIds: Set<String> = []
     private var puzzleCompletionFired: Bool = false
@@ -404,6 +408,11 @@ class TangramPuzzleScene: SKScene {
     
     // MARK: - CV Update
     
+    override func update(_ currentTime: TimeInterval) {
+        super.update(currentTime)
+        advanceModelPolygonsToDisplayTime()
+    }
+    
     /// Update scene visuals to match TangramExample visualization: render model polygons from pipeline
     /// Call this after CV results update, or when the view refreshes
     func updateFromCVPieces(_ placedPieces: [PlacedPiece]) {
@@ -558,6 +567,62 @@ class TangramPuzzleScene: SKScene {
         applyFinalSceneCenteringOnPuzzle()
     }
 
+    /// Re-pose the raw CV overlay shapes at the current host time so they move at display rate
+    /// between 15–30 Hz CV frames. Visual only: verification keeps using the measured polygons.
+    private func advanceModelPolygonsToDisplayTime() {
+        guard let poseTimeline, cvPanelTransform != nil, !cvShapeNodesByGlobalIndex.isEmpty else { return }
+        let polygons = poseTimeline.polygonsAt(CACurrentMediaTime())
+        guard !polygons.isEmpty else { return }
+        
+        for (idx, classId) in modelPlaneClassIds.enumerated() {
+            guard let shape = cvShapeNodesByGlobalIndex[idx],
+                  let poly = polygons[classId], poly.count >= 3 else { continue }
+            let path = CGMutablePath()
+            path.move(to: planeToPanel(poly[0]))
+            for k in 1..<poly.count {
+                path.addLine(to: planeToPanel(poly[k]))
+            }
+            path.closeSubpath()
+            shape.path = path
+        }
+    }
+
+    /// The CV pose of a matched piece is known well enough to accept now: its latest match error plus
+    /// the 2σ uncertainty radius stays inside the tolerances. Tolerances are in panel points / degrees.
+    internal func isCVPoseSettled(_ pieceType: TangramPieceType, positionTolerance: CGFloat, rotationToleranceDeg: CGFloat) -> Bool {
+        guard let scale = cvPanelTransform?.scale, scale > 0,
+              let metrics = cvMatchMetricsByPieceType[pieceType],
+              let uncertainty = cvPoseUncertainty(of: pieceType) else { return false }
+        // Uncertainty is in plane units; bring panel tolerances and errors into the same unit
+        return uncertainty.isWithin(
+            position: Double(positionTolerance / scale),
+            rotation: Double(rotationToleranceDeg) * .pi / 180,
+            positionError: Double(metrics.centroidError / scale),
+            rotationError: Double(metrics.rotationDeltaDegrees) * .pi / 180
+        )
+    }
+
+    /// The CV pose of a piece is certainly outside a target: its centroid error, less the 2σ
+    /// uncertainty radius, still exceeds the tolerance. Error and tolerance are in panel points.
+    private func isCVPoseBeyond(_ pieceType: TangramPieceType, positionError: CGFloat, positionTolerance: CGFloat) -> Bool {
+        guard let scale = cvPanelTransform?.scale, scale > 0,
+              let uncertainty = cvPoseUncertainty(of: pieceType) else { return false }
+        return uncertainty.isBeyond(position: Double(positionTolerance / scale), positionError: Double(positionError / scale))
+    }
+
+    private func cvPoseUncertainty(of pieceType: TangramPieceType) -> CVPoseTimeline.Uncertainty? {
+        guard let poseTimeline,
+              let classId = (0...6).first(where: { pieceTypeFromClassId($0) == pieceType }) else { return nil }
+        return poseTimeline.uncertainties()[classId]
+    }
+
+    /// Length in scene coordinates expressed in panel (targetSection) points
+    internal func sceneLengthToPanel(_ length: CGFloat) -> CGFloat {
+        let origin = targetSection.convert(CGPoint.zero, from: self)
+        let end = targetSection.convert(CGPoint(x: length, y: 0), from: self)
+        return hypot(end.x - origin.x, end.y - origin.y)
+    }
+
     /// Final global centering: move the scene camera so the puzzle outline is centered in the view
     private func applyFinalSceneCenteringOnPuzzle() {
         guard let cam = sceneCamera else { return }
@@ -788,6 +853,10 @@ class TangramPuzzleScene: SKScene {
             cvPolygonsByType: cvByType,
             panelMinDimension: panelMin
         )
+        cvMatchMetricsByPieceType = [:]
+        for match in result.perTarget.values where match.matchedCVIndex != nil {
+            cvMatchMetricsByPieceType[match.pieceType] = match.metrics
+        }
 
         var targetCentroidsById: [String: CGPoint] = [:]
         for (tid, poly) in targetPolys { targetCentroidsById[tid] = centroidOfPolygon(poly) }
@@ -850,9 +919,25 @@ class TangramPuzzleScene: SKScene {
             }
         }
         // Reset unmatched outlines unless within snap hold window
+        let config = TangramVerificationConfig.default
         for (tid, node) in targetSilhouettes where !matchedTargetsCurrentFrame.contains(tid) {
+            // A held piece whose whole uncertainty region lies outside the target has really left it:
+            // release without waiting
+            var heldPieceLeft = false
+            if let globalIdx = lastMatchedGlobalIndexByTargetId[tid], globalIdx < modelPlaneClassIds.count,
+               let pieceType = pieceTypeFromClassId(modelPlaneClassIds[globalIdx]),
+               let perTypeIdx = cvGlobalIndices[pieceType]?.firstIndex(of: globalIdx),
+               let polys = cvByType[pieceType], perTypeIdx < polys.count,
+               let targetCentroid = targetCentroidsById[tid] {
+                let cvCentroid = centroidOfPolygon(polys[perTypeIdx])
+                heldPieceLeft = isCVPoseBeyond(
+                    pieceType,
+                    positionError: hypot(cvCentroid.x - targetCentroid.x, cvCentroid.y - targetCentroid.y),
+                    positionTolerance: config.centroidErrorMaxPoints
+                )
+            }
             // If within hold, keep outline filled/colored and CV hidden
-            if let holdUntil = snapHoldUntilByTargetId[tid], now < holdUntil {
+            if let holdUntil = snapHoldUntilByTargetId[tid], now < holdUntil, !heldPieceLeft {
                 // Keep outline colored and show snapped polygon; also hide original CV if known
                 if let globalIdx = lastMatchedGlobalIndexByTargetId[tid], globalIdx >= 0 && globalIdx < modelFillColors.count {
                     let color = modelFillColors[globalIdx].withAlphaComponent(1.0)
@@ -27,6 +27,8 @@ struct TangramSpriteView: View {
     // Tangram model polygons and colors from CV pipeline
     let modelPlanePolygons: [NSNumber: [NSNumber]]
     let modelColorsRGB: [NSNumber: [NSNumber]]
+    // Filtered CV poses for re-posing the overlay between CV frames
+    let poseTimeline: CVPoseTimeline?
     // Notify CVService about view size to mirror sample app behavior
     let onViewSizeChange: (CGSize) -> Void
     let onPieceCompleted: (String, Bool) -> Void  // pieceType and isFlipped
@@ -177,6 +179,7 @@ struct TangramSpriteView: View {
         tangramScene.canvasSize = CGSize(width: 1080, height: 1920) // Match CVService viewSize
         tangramScene.puzzle = puzzle
         tangramScene.difficultySetting = difficultySetting
+        tangramScene.poseTimeline = poseTimeline
         tangramScene.onPieceCompleted = onPieceCompleted
         tangramScene.onPuzzleCompleted = onPuzzleCompleted
         tangramScene.onBackPressed = onBackPressed
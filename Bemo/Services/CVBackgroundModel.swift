@@ -0,0 +1,145 @@
+//
+//  CVBackgroundModel.swift
+//  Bemo
+//
+//  Incrementally learned low-resolution model of the board without pieces or hands
+//
+
+// WHAT: Per-tile background luma learned from still tiles, compared with each frame to find foreground tiles
+// ARCHITECTURE: Owned by CVService's pipeline worker; reuses CVMotionDetector's tile means, so it reads no pixels itself
+// USAGE: let foreground = model.update(with: motion); foreground.mask / .handInView / .bounds gate and focus later stages
+
+import Foundation
+import CoreGraphics
+
+/// Most of the camera frame is table and board that never changes. Keeping a slow running
+/// average of that surface — fed only by tiles that are still and already look like background —
+/// isolates pieces and hands for the cost of one comparison per tile, so later stages can
+/// ignore clutter outside the foreground and tell a hand over the board from a piece on it.
+final class CVBackgroundModel {
+
+    // MARK: - Types
+
+    struct Foreground: Equatable {
+        let columns: Int
+        let rows: Int
+        /// Row-major flags, true where the tile differs from the learned background
+        let mask: [Bool]
+        /// Something large reaches in from the frame border (a hand or arm over the board)
+        let handInView: Bool
+
+        var count: Int { mask.filter { $0 }.count }
+        var fraction: Double { mask.isEmpty ? 0 : Double(count) / Double(mask.count) }
+
+        /// Union of foreground tiles in normalized buffer coordinates, nil when empty
+        var bounds: CGRect? {
+            var bounds: CGRect?
+            for index in mask.indices where mask[index] {
+                let tile = CGRect(
+                    x: CGFloat(index % columns) / CGFloat(columns),
+                    y: CGFloat(index / columns) / CGFloat(rows),
+                    width: 1 / CGFloat(columns),
+                    height: 1 / CGFloat(rows)
+                )
+                bounds = bounds?.union(tile) ?? tile
+            }
+            return bounds
+        }
+    }
+
+    // MARK: - Properties
+
+    /// Luma deviation (0...255) from the background, after gain compensation, that marks foreground
+    let threshold: Float
+    /// Running-average weight of each still background observation
+    let learningRate: Float
+    /// Edge-connected foreground tiles needed to call it a hand rather than a piece near the border
+    let handMinTiles: Int
+
+    private var background: [Float] = []
+    private var columns = 0
+    private var rows = 0
+
+    // MARK: - Initialization
+
+    init(threshold: Float = 14, learningRate: Float = 0.05, handMinTiles: Int = 6) {
+        self.threshold = threshold
+        self.learningRate = learningRate
+        self.handMinTiles = handMinTiles
+    }
+
+    // MARK: - Update
+
+    /// Classify this frame's tiles and fold the still background tiles into the model.
+    /// The first frame (or a grid change) seeds the model, so whatever is on the board then
+    /// counts as background; the patch it uncovers when it moves stays foreground until reset.
+    func update(with motion: CVMotionDetector.Motion) -> Foreground {
+        let means = motion.tileMeans
+        guard !means.isEmpty, means.count == motion.columns * motion.rows else {
+            return Foreground(columns: motion.columns, rows: motion.rows, mask: [], handInView: false)
+        }
+        guard columns == motion.columns, rows == motion.rows, background.count == means.count else {
+            columns = motion.columns
+            rows = motion.rows
+            background = means
+            return Foreground(columns: columns, rows: rows, mask: [Bool](repeating: false, count: means.count), handInView: false)
+        }
+
+        // Auto-exposure shifts every tile together; compare against a gain-matched background
+        let gain = exposureGain(means)
+        let mask = zip(means, background).map { abs($0 - $1 * gain) > threshold }
+
+        // Only still tiles that look like background teach the model, so pieces stay foreground
+        for index in means.indices where !mask[index] && !motion.changedTiles[index] {
+            background[index] += learningRate * (means[index] / max(gain, 0.01) - background[index])
+        }
+        return Foreground(columns: columns, rows: rows, mask: mask, handInView: reachesInFromBorder(mask))
+    }
+
+    func reset() {
+        background = []
+        columns = 0
+        rows = 0
+    }
+
+    // MARK: - Private Helpers
+
+    /// Median ratio of current to learned luma over all tiles
+    private func exposureGain(_ means: [Float]) -> Float {
+        let ratios = zip(means, background).compactMap { current, learned in
+            learned > 8 ? current / learned : nil
+        }.sorted()
+        guard !ratios.isEmpty else { return 1 }
+        return ratios[ratios.count / 2]
+    }
+
+    /// Largest foreground component touching the frame border is at least handMinTiles
+    private func reachesInFromBorder(_ mask: [Bool]) -> Bool {
+        var visited = [Bool](repeating: false, count: mask.count)
+        let border = mask.indices.filter { index in
+            let column = index % columns, row = index / columns
+            return column == 0 || row == 0 || column == columns - 1 || row == rows - 1
+        }
+        for seed in border where mask[seed] && !visited[seed] {
+            var stack = [seed]
+            visited[seed] = true
+            var size = 0
+            while let index = stack.popLast() {
+                size += 1
+                let column = index % columns, row = index / columns
+                let neighbors = [
+                    column > 0 ? index - 1 : nil,
+                    column < columns - 1 ? index + 1 : nil,
+                    row > 0 ? index - columns : nil,
+                    row < rows - 1 ? index + columns : nil
+                ]
+                for case let neighbor? in neighbors where mask[neighbor] && !visited[neighbor] {
+                    visited[neighbor] = true
+                    stack.append(neighbor)
+                }
+            }
+            if size >= handMinTiles { return true }
+        }
+        return false
+    }
+}
@@ -0,0 +1,109 @@
+//
+//  CVCaptureFormatSelector.swift
+//  Bemo
+//
+//  Chooses the camera format from what the CV pipeline needs rather than what the sensor offers
+//
+
+// WHAT: Pipeline capture requirements plus a pure ranking of candidate camera formats against them
+// ARCHITECTURE: Service-layer helper; CVService maps AVCaptureDevice formats to candidates and applies the winner
+// USAGE: CVCaptureFormatSelector.select(from: candidates, for: .calibrated(playAreaBounds:frameSize:))
+
+import Foundation
+import CoreVideo
+
+// MARK: - Requirements
+
+/// What the pipeline needs from a frame. Refinement accuracy depends on how many pixels the
+/// smallest piece edge spans; anything beyond that (and beyond the converter's output size)
+/// is captured, transferred and thrown away.
+struct CVCaptureRequirements: Equatable {
+    /// Pixels the shortest piece edge must span for contour refinement to stay sub-pixel accurate
+    var minPixelsPerPieceEdge: Double = 48
+    /// Shortest piece edge (small triangle leg) as a fraction of the play area's side
+    var pieceEdgeFraction: Double = 0.12
+    /// Play area side as a fraction of the frame's shorter side, measured by calibration; nil until then
+    var playAreaFraction: Double?
+    /// Short side required while the play area is unmeasured; the pipeline was tuned on 1080p
+    var uncalibratedShortSide: Int = 1080
+    /// Longest side the pipeline ever processes; larger captures are downscaled first
+    var maxUsefulLongSide: Int = 1920
+    var preferredPixelFormat: OSType = CVFrameConverter.captureFormat
+    var preferredFrameRate: Double = 30
+
+    /// Shorter frame side needed to meet minPixelsPerPieceEdge
+    var requiredShortSide: Int {
+        guard let playAreaFraction else { return uncalibratedShortSide }
+        let fraction = max(pieceEdgeFraction * playAreaFraction, 1e-3)
+        return Int((minPixelsPerPieceEdge / fraction).rounded(.up))
+    }
+
+    /// Requirements for a calibrated play area given in frame pixels
+    static func calibrated(playAreaBounds: CGRect, frameSize: CGSize) -> CVCaptureRequirements {
+        var requirements = CVCaptureRequirements()
+        let frameShort = min(frameSize.width, frameSize.height)
+        let playShort = min(playAreaBounds.width, playAreaBounds.height)
+        if frameShort > 0, playShort > 0 {
+            requirements.playAreaFraction = min(1, Double(playShort / frameShort))
+        }
+        return requirements
+    }
+}
+
+// MARK: - Selector
+
+enum CVCaptureFormatSelector {
+
+    /// Device-independent description of one camera format
+    struct Candidate: Equatable {
+        /// Caller's handle, e.g. the index into AVCaptureDevice.formats
+        let id: Int
+        let width: Int
+        let height: Int
+        let pixelFormat: OSType
+        let minFrameRate: Double
+        let maxFrameRate: Double
+
+        var shortSide: Int { min(width, height) }
+        var longSide: Int { max(width, height) }
+        var area: Int { width * height }
+
+        func supports(frameRate: Double) -> Bool {
+            minFrameRate <= frameRate && frameRate <= maxFrameRate
+        }
+    }
+
+    /// Best candidate for the requirements, or nil when none runs at the preferred frame rate
+    static func select(from candidates: [Candidate], for requirements: CVCaptureRequirements) -> Candidate? {
+        rank(candidates, for: requirements).first
+    }
+
+    /// Candidates at the preferred frame rate, best first:
+    /// 1. formats whose pipeline-size short side meets the requirement, smallest capture first;
+    /// 2. otherwise the most pipeline pixels available, since accuracy is already short;
+    /// ties prefer the pipeline's pixel format.
+    static func rank(_ candidates: [Candidate], for requirements: CVCaptureRequirements) -> [Candidate] {
+        let required = Double(requirements.requiredShortSide)
+        return candidates
+            .filter { $0.supports(frameRate: requirements.preferredFrameRate) }
+            .sorted { a, b in
+                let aEffective = effectiveShortSide(of: a, maxLongSide: requirements.maxUsefulLongSide)
+                let bEffective = effectiveShortSide(of: b, maxLongSide: requirements.maxUsefulLongSide)
+                let aMeets = aEffective >= required
+                let bMeets = bEffective >= required
+                if aMeets != bMeets { return aMeets }
+                if !aMeets, aEffective != bEffective { return aEffective > bEffective }
+                if a.area != b.area { return a.area < b.area }
+                let aFormat = a.pixelFormat == requirements.preferredPixelFormat
+                let bFormat = b.pixelFormat == requirements.preferredPixelFormat
+                if aFormat != bFormat { return aFormat }
+                return a.id < b.id
+            }
+    }
+
+    /// Short side after the pipeline's downscale to `maxLongSide`
+    static func effectiveShortSide(of candidate: Candidate, maxLongSide: Int) -> Double {
+        guard candidate.longSide > 0 else { return 0 }
+        return Double(candidate.shortSide) * min(1, Double(maxLongSide) / Double(candidate.longSide))
+    }
+}
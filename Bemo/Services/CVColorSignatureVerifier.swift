@@ -0,0 +1,191 @@
+//
+//  CVColorSignatureVerifier.swift
+//  Bemo
+//
+//  Per-piece chroma histograms that confirm a tracked piece is still where it is predicted
+//
+
+// WHAT: Online 8×8 CbCr histogram per stable class id, compared against sparse samples inside a polygon
+// ARCHITECTURE: Owned by CVService; reads the camera buffer's native chroma plane (or BGRA), no conversion or allocation per sample
+// USAGE: learn(_:polygon:in:) on detected pieces, verify(_:polygon:in:) on predicted ones; polygons are in normalized buffer coordinates
+
+import Foundation
+import CoreGraphics
+import CoreVideo
+
+/// Every tangram piece has a distinct color, so a few dozen chroma samples inside the predicted
+/// outline are enough to tell whether the tracked piece is still there. That check costs
+/// microseconds, confirms tracks the detector missed this frame, and flags identity mix-ups.
+final class CVColorSignatureVerifier {
+
+    // MARK: - Types
+
+    struct Verification: Equatable {
+        /// Detected pieces whose colors match their signature
+        var confirmed: Set<Int> = []
+        /// Pieces the detector missed but whose predicted outline still shows their color
+        var verifiedWithoutDetection: Set<Int> = []
+        /// Detected pieces whose colors contradict their signature
+        var mismatched: Set<Int> = []
+    }
+
+    // MARK: - Properties
+
+    /// Histogram bins per chroma axis
+    static let bins = 8
+    /// Sample grid side; at most gridSide² points are tested per polygon
+    private let gridSide = 8
+    /// Polygons are shrunk toward their centroid by this factor so samples avoid edges and shadows
+    private let inset: CGFloat = 0.75
+    /// Weight of each new observation in a signature
+    private let learningRate: Float = 0.1
+    /// Bhattacharyya coefficient needed to call a sample set a match
+    let acceptSimilarity: Double
+
+    private var signatures: [Int: [Float]] = [:]
+
+    // MARK: - Initialization
+
+    init(acceptSimilarity: Double = 0.6) {
+        self.acceptSimilarity = acceptSimilarity
+    }
+
+    // MARK: - Signatures
+
+    /// Fold a detected piece's colors into its signature. Samples that contradict an established
+    /// signature are not learned, so one mislabeled frame cannot overwrite it.
+    /// - Returns: similarity to the prior signature, or nil when none existed or nothing was sampled
+    @discardableResult
+    func learn(_ classId: Int, polygon: [CGPoint], in pixelBuffer: CVPixelBuffer) -> Double? {
+        guard let histogram = histogram(inside: polygon, in: pixelBuffer) else { return nil }
+        guard let signature = signatures[classId] else {
+            signatures[classId] = histogram
+            return nil
+        }
+        let similarity = Self.similarity(signature, histogram)
+        if similarity >= acceptSimilarity {
+            signatures[classId] = zip(signature, histogram).map { $0 + learningRate * ($1 - $0) }
+        }
+        return similarity
+    }
+
+    /// Similarity of the colors inside `polygon` to the piece's signature, nil without a signature or samples
+    func verify(_ classId: Int, polygon: [CGPoint], in pixelBuffer: CVPixelBuffer) -> Double? {
+        guard let signature = signatures[classId],
+              let histogram = histogram(inside: polygon, in: pixelBuffer) else { return nil }
+        return Self.similarity(signature, histogram)
+    }
+
+    func reset() {
+        signatures.removeAll()
+    }
+
+    // MARK: - Sampling
+
+    /// Normalized CbCr histogram of grid samples inside the inset polygon (normalized buffer coordinates)
+    func histogram(inside polygon: [CGPoint], in pixelBuffer: CVPixelBuffer) -> [Float]? {
+        guard polygon.count >= 3 else { return nil }
+        let center = CGPoint(
+            x: polygon.reduce(0) { $0 + $1.x } / CGFloat(polygon.count),
+            y: polygon.reduce(0) { $0 + $1.y } / CGFloat(polygon.count)
+        )
+        let shrunk = polygon.map {
+            CGPoint(x: center.x + ($0.x - center.x) * inset, y: center.y + ($0.y - center.y) * inset)
+        }
+        let minX = shrunk.map(\.x).min()!, maxX = shrunk.map(\.x).max()!
+        let minY = shrunk.map(\.y).min()!, maxY = shrunk.map(\.y).max()!
+        guard minX >= 0, minY >= 0, maxX <= 1, maxY <= 1 else { return nil }
+
+        var points: [CGPoint] = []
+        points.reserveCapacity(gridSide * gridSide)
+        for row in 0..<gridSide {
+            for column in 0..<gridSide {
+                let point = CGPoint(
+                    x: minX + (maxX - minX) * (CGFloat(column) + 0.5) / CGFloat(gridSide),
+                    y: minY + (maxY - minY) * (CGFloat(row) + 0.5) / CGFloat(gridSide)
+                )
+                if Self.contains(shrunk, point) { points.append(point) }
+            }
+        }
+        guard !points.isEmpty else { return nil }
+
+        var histogram = [Float](repeating: 0, count: Self.bins * Self.bins)
+        let sampled = Self.forEachChroma(at: points, in: pixelBuffer) { cb, cr in
+            let cbBin = Int(cb) * Self.bins / 256
+            let crBin = Int(cr) * Self.bins / 256
+            histogram[crBin * Self.bins + cbBin] += 1
+        }
+        guard sampled > 0 else { return nil }
+        let scale = 1 / Float(sampled)
+        return histogram.map { $0 * scale }
+    }
+
+    // MARK: - Private Helpers
+
+    /// Bhattacharyya coefficient of two normalized histograms: 1 identical, 0 disjoint
+    private static func similarity(_ a: [Float], _ b: [Float]) -> Double {
+        zip(a, b).reduce(0) { $0 + Double(($1.0 * $1.1).squareRoot()) }
+    }
+
+    /// Same-sign cross products: point inside a convex polygon of either winding
+    private static func contains(_ polygon: [CGPoint], _ point: CGPoint) -> Bool {
+        var sign: CGFloat = 0
+        for i in 0..<polygon.count {
+            let a = polygon[i], b = polygon[(i + 1) % polygon.count]
+            let cross = (b.x - a.x) * (point.y - a.y) - (b.y - a.y) * (point.x - a.x)
+            if cross == 0 { continue }
+            if sign == 0 {
+                sign = cross
+            } else if (cross > 0) != (sign > 0) {
+                return false
+            }
+        }
+        return true
+    }
+
+    /// Visit CbCr at normalized points: straight from the chroma plane for bi-planar YUV,
+    /// converted per sample for BGRA. Returns the number of samples visited.
+    private static func forEachChroma(at points: [CGPoint], in pixelBuffer: CVPixelBuffer, _ body: (UInt8, UInt8) -> Void) -> Int {
+        let format = CVPixelBufferGetPixelFormatType(pixelBuffer)
+        CVPixelBufferLockBaseAddress(pixelBuffer, .readOnly)
+        defer { CVPixelBufferUnlockBaseAddress(pixelBuffer, .readOnly) }
+
+        switch format {
+        case kCVPixelFormatType_420YpCbCr8BiPlanarFullRange, kCVPixelFormatType_420YpCbCr8BiPlanarVideoRange:
+            guard let base = CVPixelBufferGetBaseAddressOfPlane(pixelBuffer, 1)?.assumingMemoryBound(to: UInt8.self) else { return 0 }
+            let width = CVPixelBufferGetWidthOfPlane(pixelBuffer, 1)
+            let height = CVPixelBufferGetHeightOfPlane(pixelBuffer, 1)
+            let rowBytes = CVPixelBufferGetBytesPerRowOfPlane(pixelBuffer, 1)
+            for point in points {
+                let x = min(width - 1, Int(point.x * CGFloat(width)))
+                let y = min(height - 1, Int(point.y * CGFloat(height)))
+                let pixel = base + y * rowBytes + x * 2
+                body(pixel[0], pixel[1])
+            }
+            return points.count
+        case kCVPixelFormatType_32BGRA:
+            guard let base = CVPixelBufferGetBaseAddress(pixelBuffer)?.assumingMemoryBound(to: UInt8.self) else { return 0 }
+            let width = CVPixelBufferGetWidth(pixelBuffer)
+            let height = CVPixelBufferGetHeight(pixelBuffer)
+            let rowBytes = CVPixelBufferGetBytesPerRow(pixelBuffer)
+            // Full-range YCbCr with the matrix the capture conversion used, so signatures learned
+            // from BGRA and bi-planar frames land in the same bins
+            let (kr, kb) = CVFrameConverter.colorMatrix(of: pixelBuffer).lumaWeights
+            let kg = 1 - kr - kb
+            let cbScale = 1 / (2 * (1 - kb)), crScale = 1 / (2 * (1 - kr))
+            for point in points {
+                let x = min(width - 1, Int(point.x * CGFloat(width)))
+                let y = min(height - 1, Int(point.y * CGFloat(height)))
+                let pixel = base + y * rowBytes + x * 4
+                let b = Float(pixel[0]), g = Float(pixel[1]), r = Float(pixel[2])
+                let luma = kr * r + kg * g + kb * b
+                let cb = 128 + (b - luma) * cbScale
+                let cr = 128 + (r - luma) * crScale
+                body(UInt8(max(0, min(255, cb))), UInt8(max(0, min(255, cr))))
+            }
+            return points.count
+        default:
+            return 0
+        }
+    }
+}
@@ -0,0 +1,238 @@
+//
+//  CVFrameConverter.swift
+//  Bemo
+//
+//  Bi-planar YUV camera frames to pipeline-ready BGRA buffers
+//
+
+// WHAT: Downscales 420f luma/chroma planes to the pipeline's working size, then color-converts only those pixels
+// ARCHITECTURE: Helper owned by CVService; keeps capture in the sensor's native format and pools its output buffers
+// USAGE: Capture with CVFrameConverter.captureFormat, then pass each frame through pipelineBuffer(from:)
+
+import Foundation
+import CoreVideo
+import Accelerate
+
+/// Asking AVFoundation for BGRA makes the capture stack convert every full-resolution frame
+/// (4 bytes/pixel) before we see it. Capturing 420f (1.5 bytes/pixel) and converting after the
+/// downscale touches far fewer bytes and skips the full-frame conversion entirely.
+final class CVFrameConverter {
+
+    // MARK: - Types
+
+    /// YCbCr → RGB matrices the capture stack tags buffers with
+    enum ColorMatrix: Equatable {
+        case itu601
+        case itu709
+        case itu2020
+
+        /// Red and blue luma weights (Kr, Kb) defining the matrix
+        var lumaWeights: (red: Float, blue: Float) {
+            switch self {
+            case .itu601: return (0.299, 0.114)
+            case .itu709: return (0.2126, 0.0722)
+            case .itu2020: return (0.2627, 0.0593)
+            }
+        }
+    }
+
+    // MARK: - Properties
+
+    /// Native sensor format: full-range Y plane plus interleaved half-resolution CbCr plane
+    static let captureFormat = kCVPixelFormatType_420YpCbCr8BiPlanarFullRange
+
+    /// Longest side of the buffer handed to the pipeline; matches CVService's portrait view size
+    let maxLongSide: Int
+
+    private var conversionInfo = vImage_YpCbCrToARGB()
+    /// Matrix conversionInfo was generated for, nil until the first frame
+    private var conversionMatrix: ColorMatrix?
+
+    private var pool: CVPixelBufferPool?
+    private var poolWidth = 0
+    private var poolHeight = 0
+
+    // Scratch planes for the downscaled Y and CbCr, reused across frames
+    private var scaledLuma: [UInt8] = []
+    private var scaledChroma: [UInt8] = []
+
+    // MARK: - Initialization
+
+    init(maxLongSide: Int = 1920) {
+        self.maxLongSide = maxLongSide
+    }
+
+    // MARK: - Conversion
+
+    /// BGRA buffer for the pipeline. BGRA input passes through untouched; 420f input is scaled
+    /// plane-by-plane and converted into a pooled buffer. Returns nil for unsupported formats.
+    func pipelineBuffer(from pixelBuffer: CVPixelBuffer) -> CVPixelBuffer? {
+        switch CVPixelBufferGetPixelFormatType(pixelBuffer) {
+        case kCVPixelFormatType_32BGRA:
+            return pixelBuffer
+        case kCVPixelFormatType_420YpCbCr8BiPlanarFullRange:
+            return convertBiPlanar(pixelBuffer)
+        default:
+            return nil
+        }
+    }
+
+    // MARK: - Color
+
+    /// Matrix from the buffer's YCbCr attachment; untagged buffers follow the usual convention
+    /// of BT.709 for HD sizes and BT.601 below
+    static func colorMatrix(of pixelBuffer: CVPixelBuffer) -> ColorMatrix {
+        let tag = CVBufferCopyAttachment(pixelBuffer, kCVImageBufferYCbCrMatrixKey, nil) as? String
+        switch tag {
+        case kCVImageBufferYCbCrMatrix_ITU_R_709_2 as String:
+            return .itu709
+        case kCVImageBufferYCbCrMatrix_ITU_R_2020 as String:
+            return .itu2020
+        case kCVImageBufferYCbCrMatrix_ITU_R_601_4 as String:
+            return .itu601
+        default:
+            let isHD = min(CVPixelBufferGetWidth(pixelBuffer), CVPixelBufferGetHeight(pixelBuffer)) >= 720
+            return isHD ? .itu709 : .itu601
+        }
+    }
+
+    // MARK: - Private Helpers
+
+    private func convertBiPlanar(_ source: CVPixelBuffer) -> CVPixelBuffer? {
+        guard prepareConversionInfo(for: Self.colorMatrix(of: source)) else { return nil }
+
+        let width = CVPixelBufferGetWidth(source)
+        let height = CVPixelBufferGetHeight(source)
+        let scale = min(1, Double(maxLongSide) / Double(max(width, height)))
+        // 4:2:0 chroma needs even dimensions
+        let outWidth = max(2, Int(Double(width) * scale) & ~1)
+        let outHeight = max(2, Int(Double(height) * scale) & ~1)
+
+        guard let output = makeOutputBuffer(width: outWidth, height: outHeight) else { return nil }
+
+        CVPixelBufferLockBaseAddress(source, .readOnly)
+        CVPixelBufferLockBaseAddress(output, [])
+        defer {
+            CVPixelBufferUnlockBaseAddress(output, [])
+            CVPixelBufferUnlockBaseAddress(source, .readOnly)
+        }
+
+        guard let lumaBase = CVPixelBufferGetBaseAddressOfPlane(source, 0),
+              let chromaBase = CVPixelBufferGetBaseAddressOfPlane(source, 1),
+              let outputBase = CVPixelBufferGetBaseAddress(output) else { return nil }
+
+        var lumaIn = vImage_Buffer(
+            data: lumaBase,
+            height: vImagePixelCount(height),
+            width: vImagePixelCount(width),
+            rowBytes: CVPixelBufferGetBytesPerRowOfPlane(source, 0)
+        )
+        var chromaIn = vImage_Buffer(
+            data: chromaBase,
+            height: vImagePixelCount(height / 2),
+            width: vImagePixelCount(width / 2),
+            rowBytes: CVPixelBufferGetBytesPerRowOfPlane(source, 1)
+        )
+        var bgraOut = vImage_Buffer(
+            data: outputBase,
+            height: vImagePixelCount(outHeight),
+            width: vImagePixelCount(outWidth),
+            rowBytes: CVPixelBufferGetBytesPerRow(output)
+        )
+
+        // ARGB → BGRA
+        let permuteMap: [UInt8] = [3, 2, 1, 0]
+
+        guard outWidth != width || outHeight != height else {
+            let error = vImageConvert_420Yp8_CbCr8ToARGB8888(
+                &lumaIn, &chromaIn, &bgraOut, &conversionInfo, permuteMap, 255, vImage_Flags(kvImageNoFlags)
+            )
+            return error == kvImageNoError ? output : nil
+        }
+
+        if scaledLuma.count != outWidth * outHeight {
+            scaledLuma = [UInt8](repeating: 0, count: outWidth * outHeight)
+            scaledChroma = [UInt8](repeating: 0, count: outWidth * outHeight / 2)
+        }
+
+        let error: vImage_Error = scaledLuma.withUnsafeMutableBytes { lumaBytes in
+            scaledChroma.withUnsafeMutableBytes { chromaBytes in
+                var lumaScaled = vImage_Buffer(
+                    data: lumaBytes.baseAddress,
+                    height: vImagePixelCount(outHeight),
+                    width: vImagePixelCount(outWidth),
+                    rowBytes: outWidth
+                )
+                var chromaScaled = vImage_Buffer(
+                    data: chromaBytes.baseAddress,
+                    height: vImagePixelCount(outHeight / 2),
+                    width: vImagePixelCount(outWidth / 2),
+                    rowBytes: outWidth
+                )
+                var status = vImageScale_Planar8(&lumaIn, &lumaScaled, nil, vImage_Flags(kvImageNoFlags))
+                guard status == kvImageNoError else { return status }
+                status = vImageScale_CbCr8(&chromaIn, &chromaScaled, nil, vImage_Flags(kvImageNoFlags))
+                guard status == kvImageNoError else { return status }
+                return vImageConvert_420Yp8_CbCr8ToARGB8888(
+                    &lumaScaled, &chromaScaled, &bgraOut, &conversionInfo, permuteMap, 255, vImage_Flags(kvImageNoFlags)
+                )
+            }
+        }
+        return error == kvImageNoError ? output : nil
+    }
+
+    private func prepareConversionInfo(for matrix: ColorMatrix) -> Bool {
+        guard conversionMatrix != matrix else { return true }
+        // Full-range video: luma spans 0...255, chroma centered on 128
+        var pixelRange = vImage_YpCbCrPixelRange(
+            Yp_bias: 0, CbCr_bias: 128,
+            YpRangeMax: 255, CbCrRangeMax: 255,
+            YpMax: 255, YpMin: 0,
+            CbCrMax: 255, CbCrMin: 0
+        )
+        let error: vImage_Error
+        switch matrix {
+        case .itu601:
+            error = generateConversion(kvImage_YpCbCrToARGBMatrix_ITU_R_601_4, pixelRange: &pixelRange)
+        case .itu709:
+            error = generateConversion(kvImage_YpCbCrToARGBMatrix_ITU_R_709_2, pixelRange: &pixelRange)
+        case .itu2020:
+            // vImage has no BT.2020 preset; Kr = 0.2627, Kb = 0.0593
+            var bt2020 = vImage_YpCbCrToARGBMatrix(Yp: 1, Cr_R: 1.4746, Cr_G: -0.57135, Cb_G: -0.16455, Cb_B: 1.8814)
+            error = generateConversion(&bt2020, pixelRange: &pixelRange)
+        }
+        conversionMatrix = error == kvImageNoError ? matrix : nil
+        return conversionMatrix != nil
+    }
+
+    private func generateConversion(_ matrix: UnsafePointer<vImage_YpCbCrToARGBMatrix>, pixelRange: inout vImage_YpCbCrPixelRange) -> vImage_Error {
+        vImageConvert_YpCbCrToARGB_GenerateConversion(
+            matrix,
+            &pixelRange,
+            &conversionInfo,
+            kvImage420Yp8_CbCr8,
+            kvImageARGB8888,
+            vImage_Flags(kvImageNoFlags)
+        )
+    }
+
+    private func makeOutputBuffer(width: Int, height: Int) -> CVPixelBuffer? {
+        if pool == nil || poolWidth != width || poolHeight != height {
+            let attributes: [String: Any] = [
+                kCVPixelBufferPixelFormatTypeKey as String: kCVPixelFormatType_32BGRA,
+                kCVPixelBufferWidthKey as String: width,
+                kCVPixelBufferHeightKey as String: height,
+                kCVPixelBufferIOSurfacePropertiesKey as String: [:]
+            ]
+            var newPool: CVPixelBufferPool?
+            CVPixelBufferPoolCreate(kCFAllocatorDefault, nil, attributes as CFDictionary, &newPool)
+            pool = newPool
+            poolWidth = width
+            poolHeight = height
+        }
+        guard let pool else { return nil }
+        var buffer: CVPixelBuffer?
+        CVPixelBufferPoolCreatePixelBuffer(kCFAllocatorDefault, pool, &buffer)
+        return buffer
+    }
+}
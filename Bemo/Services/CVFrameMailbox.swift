@@ -0,0 +1,85 @@
+//
+//  CVFrameMailbox.swift
+//  Bemo
+//
+//  Single-slot, latest-frame-wins handoff between the capture callback and the pipeline worker
+//
+
+// WHAT: Holds at most one pending frame; posting replaces (and releases) any frame the worker has not taken yet
+// ARCHITECTURE: Owned by CVService; the capture queue posts, a serial processing queue drains
+// USAGE: if mailbox.post(frame) { wake worker }; worker loops `while let frame = mailbox.take()`
+
+import Foundation
+
+/// Processing inline in the capture callback lets AVFoundation decide which frames to drop and
+/// always hands the pipeline whatever was queued behind the slow frame. With one slot, the
+/// capture side never waits and the worker always gets the newest frame; superseded frames
+/// are released immediately so their buffers return to the capture pool.
+final class CVFrameMailbox<Frame> {
+
+    // MARK: - Types
+
+    struct Stats: Equatable {
+        /// Frames handed to post(_:)
+        var posted: Int = 0
+        /// Frames the worker took
+        var taken: Int = 0
+        /// Frames replaced in the slot before the worker reached them
+        var replaced: Int = 0
+    }
+
+    // MARK: - Properties
+
+    private let lock = NSLock()
+    private var slot: Frame?
+    /// True while a worker is draining; lets post(_:) tell the caller whether to schedule one
+    private var consumerActive = false
+    private var counters = Stats()
+
+    var stats: Stats {
+        lock.lock()
+        defer { lock.unlock() }
+        return counters
+    }
+
+    // MARK: - Producer
+
+    /// Store `frame`, replacing any pending one. Never blocks on the worker.
+    /// - Returns: true when no worker is draining and the caller must schedule one
+    @discardableResult
+    func post(_ frame: Frame) -> Bool {
+        lock.lock()
+        let displaced = slot
+        slot = frame
+        counters.posted += 1
+        if displaced != nil { counters.replaced += 1 }
+        let needsWake = !consumerActive
+        consumerActive = true
+        lock.unlock()
+        // `displaced` is released here, outside the lock
+        return needsWake
+    }
+
+    // MARK: - Consumer
+
+    /// Newest pending frame, or nil when empty. Returning nil ends the drain: the next post(_:) asks for a new worker.
+    func take() -> Frame? {
+        lock.lock()
+        defer { lock.unlock() }
+        guard let frame = slot else {
+            consumerActive = false
+            return nil
+        }
+        slot = nil
+        counters.taken += 1
+        return frame
+    }
+
+    /// Drop any pending frame and zero the counters (capture stopped)
+    func reset() {
+        lock.lock()
+        defer { lock.unlock() }
+        slot = nil
+        counters = Stats()
+    }
+}
@@ -0,0 +1,180 @@
+//
+//  CVLensDistortionModel.swift
+//  Bemo
+//
+//  Camera intrinsics and Brown–Conrady distortion with a precomputed sparse correction grid
+//
+
+// WHAT: Undistorts individual image points through a low-resolution lookup grid with bilinear interpolation
+// ARCHITECTURE: Service-layer model owned by CVService; built once per camera from bundled or calibrated parameters
+// USAGE: CVLensDistortionModel(calibration:) then undistort(_:) / distort(_:) on normalized buffer points (never whole frames)
+
+import Foundation
+import CoreGraphics
+
+/// The ultra-wide front camera bends straight edges near the frame border, which a planar
+/// homography cannot absorb. Remapping every frame would cost more than the detector, but
+/// only a handful of points (piece positions, vertices, boxes) ever matter, so those are
+/// corrected individually through a grid solved once at load time.
+struct CVLensDistortionModel {
+
+    // MARK: - Types
+
+    /// Intrinsics and distortion in pixels of the delivered (portrait, unmirrored) buffer
+    struct Calibration: Codable, Equatable {
+        var width: Double
+        var height: Double
+        var fx: Double
+        var fy: Double
+        var cx: Double
+        var cy: Double
+        var k1: Double = 0
+        var k2: Double = 0
+        var k3: Double = 0
+        var p1: Double = 0
+        var p2: Double = 0
+
+        private enum CodingKeys: String, CodingKey {
+            case width, height, fx, fy, cx, cy, k1, k2, k3, p1, p2
+        }
+
+        /// Same lens seen through a horizontally mirrored buffer
+        func mirrored() -> Calibration {
+            var flipped = self
+            flipped.cx = width - cx
+            // x → -x flips the sign of the p2 tangential term
+            flipped.p2 = -p2
+            return flipped
+        }
+    }
+
+    // MARK: - Properties
+
+    let calibration: Calibration
+    /// Grid nodes per side; distortion is smooth, so 33 nodes keep bilinear error far below a pixel
+    let gridSize: Int
+    /// Undistorted normalized position for each distorted grid node, row-major
+    private let grid: [CGPoint]
+
+    // MARK: - Initialization
+
+    init(calibration: Calibration, gridSize: Int = 33) {
+        self.calibration = calibration
+        self.gridSize = max(2, gridSize)
+        var nodes: [CGPoint] = []
+        nodes.reserveCapacity(self.gridSize * self.gridSize)
+        for row in 0..<self.gridSize {
+            for column in 0..<self.gridSize {
+                let distorted = CGPoint(
+                    x: Double(column) / Double(self.gridSize - 1),
+                    y: Double(row) / Double(self.gridSize - 1)
+                )
+                nodes.append(Self.solveUndistorted(distorted, calibration: calibration))
+            }
+        }
+        self.grid = nodes
+    }
+
+    // MARK: - Correction
+
+    /// Undistorted position of a point given in normalized [0, 1] buffer coordinates
+    func undistort(_ point: CGPoint) -> CGPoint {
+        let last = Double(gridSize - 1)
+        let gx = min(max(Double(point.x), 0), 1) * last
+        let gy = min(max(Double(point.y), 0), 1) * last
+        let column = min(Int(gx), gridSize - 2)
+        let row = min(Int(gy), gridSize - 2)
+        let fx = CGFloat(gx - Double(column))
+        let fy = CGFloat(gy - Double(row))
+
+        let topLeft = grid[row * gridSize + column]
+        let topRight = grid[row * gridSize + column + 1]
+        let bottomLeft = grid[(row + 1) * gridSize + column]
+        let bottomRight = grid[(row + 1) * gridSize + column + 1]
+        let top = CGPoint(x: topLeft.x + (topRight.x - topLeft.x) * fx, y: topLeft.y + (topRight.y - topLeft.y) * fx)
+        let bottom = CGPoint(x: bottomLeft.x + (bottomRight.x - bottomLeft.x) * fx, y: bottomLeft.y + (bottomRight.y - bottomLeft.y) * fx)
+        let corrected = CGPoint(x: top.x + (bottom.x - top.x) * fy, y: top.y + (bottom.y - top.y) * fy)
+
+        // Points outside the frame keep their offset from the clamped edge
+        let clamped = CGPoint(x: gx / last, y: gy / last)
+        return CGPoint(x: corrected.x + (point.x - clamped.x), y: corrected.y + (point.y - clamped.y))
+    }
+
+    /// Where an ideal (undistorted) normalized point lands in the delivered buffer; exact, no grid
+    func distort(_ point: CGPoint) -> CGPoint {
+        let c = calibration
+        let x = (Double(point.x) * c.width - c.cx) / c.fx
+        let y = (Double(point.y) * c.height - c.cy) / c.fy
+        let distorted = Self.applyDistortion(x: x, y: y, calibration: c)
+        return CGPoint(x: (distorted.x * c.fx + c.cx) / c.width, y: (distorted.y * c.fy + c.cy) / c.height)
+    }
+
+    func undistort(_ rect: CGRect) -> CGRect {
+        let corners = [
+            CGPoint(x: rect.minX, y: rect.minY), CGPoint(x: rect.maxX, y: rect.minY),
+            CGPoint(x: rect.maxX, y: rect.maxY), CGPoint(x: rect.minX, y: rect.maxY)
+        ].map(undistort)
+        let xs = corners.map(\.x), ys = corners.map(\.y)
+        return CGRect(x: xs.min()!, y: ys.min()!, width: xs.max()! - xs.min()!, height: ys.max()! - ys.min()!)
+    }
+
+    // MARK: - Loading
+
+    /// Parameters for a camera type (AVCaptureDevice.DeviceType raw value) from bundled camera_calibration.json
+    static func bundled(for cameraType: String, bundle: Bundle = .main) -> Calibration? {
+        guard let url = bundle.url(forResource: "camera_calibration", withExtension: "json"),
+              let data = try? Data(contentsOf: url),
+              let table = try? JSONDecoder().decode([String: Calibration].self, from: data) else {
+            return nil
+        }
+        return table[cameraType]
+    }
+
+    // MARK: - Private Helpers
+
+    /// Invert the distortion at one normalized buffer point by fixed-point iteration
+    private static func solveUndistorted(_ point: CGPoint, calibration c: Calibration) -> CGPoint {
+        let xd = (Double(point.x) * c.width - c.cx) / c.fx
+        let yd = (Double(point.y) * c.height - c.cy) / c.fy
+        var x = xd, y = yd
+        for _ in 0..<20 {
+            let r2 = x * x + y * y
+            let radial = 1 + c.k1 * r2 + c.k2 * r2 * r2 + c.k3 * r2 * r2 * r2
+            let dx = 2 * c.p1 * x * y + c.p2 * (r2 + 2 * x * x)
+            let dy = c.p1 * (r2 + 2 * y * y) + 2 * c.p2 * x * y
+            x = (xd - dx) / radial
+            y = (yd - dy) / radial
+        }
+        return CGPoint(x: (x * c.fx + c.cx) / c.width, y: (y * c.fy + c.cy) / c.height)
+    }
+
+    /// Brown–Conrady forward model in camera-normalized coordinates
+    private static func applyDistortion(x: Double, y: Double, calibration c: Calibration) -> (x: Double, y: Double) {
+        let r2 = x * x + y * y
+        let radial = 1 + c.k1 * r2 + c.k2 * r2 * r2 + c.k3 * r2 * r2 * r2
+        return (
+            x * radial + 2 * c.p1 * x * y + c.p2 * (r2 + 2 * x * x),
+            y * radial + c.p1 * (r2 + 2 * y * y) + 2 * c.p2 * x * y
+        )
+    }
+}
+
+// MARK: - Decoding
+
+extension CVLensDistortionModel.Calibration {
+    /// Distortion terms a calibration leaves out are zero; intrinsics are required
+    init(from decoder: Decoder) throws {
+        let container = try decoder.container(keyedBy: CodingKeys.self)
+        width = try container.decode(Double.self, forKey: .width)
+        height = try container.decode(Double.self, forKey: .height)
+        fx = try container.decode(Double.self, forKey: .fx)
+        fy = try container.decode(Double.self, forKey: .fy)
+        cx = try container.decode(Double.self, forKey: .cx)
+        cy = try container.decode(Double.self, forKey: .cy)
+        k1 = try container.decodeIfPresent(Double.self, forKey: .k1) ?? 0
+        k2 = try container.decodeIfPresent(Double.self, forKey: .k2) ?? 0
+        k3 = try container.decodeIfPresent(Double.self, forKey: .k3) ?? 0
+        p1 = try container.decodeIfPresent(Double.self, forKey: .p1) ?? 0
+        p2 = try container.decodeIfPresent(Double.self, forKey: .p2) ?? 0
+    }
+}
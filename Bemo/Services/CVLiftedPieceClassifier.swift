@@ -0,0 +1,188 @@
+//
+//  CVLiftedPieceClassifier.swift
+//  Bemo
+//
+//  Tells pieces lying on the board from pieces held above it
+//
+
+// WHAT: Per tracked piece, apparent size confirmed by edge sharpness or tracker motion, with hysteresis
+// ARCHITECTURE: Owned by CVService's pipeline worker; samples luma along each piece's projected outline
+// USAGE: let lifted = classifier.classify(observations, in: cameraBuffer); drop lifted ids before plane-based updates
+
+import Foundation
+import CoreGraphics
+import CoreVideo
+
+/// A piece in a child's hand sits closer to the camera than the board, so the board homography
+/// projects its model outline too small and its real edges land outside it; it is usually also
+/// blurred and moving. Blur and motion go together for a piece slid across the board, so they
+/// only confirm: a piece counts as lifted when it looks too large for its outline and one of them
+/// agrees, over consecutive frames, and it returns to the plane only after several frames that
+/// look on-plane again.
+final class CVLiftedPieceClassifier {
+
+    // MARK: - Types
+
+    struct Observation {
+        let classId: Int
+        /// Model outline projected through the board homography, normalized buffer coordinates
+        let outline: [CGPoint]
+        /// Tracker residual quality (0...1), nil when the track is too new to tell
+        let quality: Double?
+    }
+
+    private struct PieceState {
+        /// Edge contrast measured while the piece lay still on the board
+        var referenceContrast: Float?
+        var isLifted = false
+        var liftedStreak = 0
+        var onPlaneStreak = 0
+    }
+
+    private struct LumaPlane {
+        let base: UnsafePointer<UInt8>
+        let width: Int
+        let height: Int
+        let rowBytes: Int
+        let pixelStride: Int
+
+        func value(at point: CGPoint) -> Float? {
+            let x = Int(point.x), y = Int(point.y)
+            guard x >= 0, y >= 0, x < width, y < height else { return nil }
+            return Float(base[y * rowBytes + x * pixelStride])
+        }
+    }
+
+    // MARK: - Properties
+
+    /// Outline scales probed about the centroid; a lifted piece shows its edges at a scale above 1
+    static let probeScales: [CGFloat] = [0.9, 1.0, 1.15, 1.3]
+    /// Apparent scale from which the outline counts as too small for the piece
+    let liftedScale: CGFloat = 1.15
+    /// Peak edge contrast below this fraction of the on-plane reference counts as blurred
+    let blurRatio: Float = 0.5
+    /// Tracker quality below this counts as moving
+    let movingQuality: Double = 0.3
+    /// Consecutive frames needed to enter / leave the lifted state
+    let enterFrames = 2
+    let exitFrames = 3
+
+    private let samplesPerEdge = 6
+    /// Inside/outside probe distance as a fraction of the edge's distance from the centroid;
+    /// kept below the 10% gap between probe scales so neighbouring scales do not both straddle an edge
+    private let probeOffset: CGFloat = 0.06
+    private let referenceSmoothing: Float = 0.1
+
+    private var states: [Int: PieceState] = [:]
+
+    // MARK: - Classification
+
+    /// Update every observed piece and return the class ids currently considered lifted.
+    /// Pieces not observed this frame keep their state until reset.
+    func classify(_ observations: [Observation], in pixelBuffer: CVPixelBuffer) -> Set<Int> {
+        CVPixelBufferLockBaseAddress(pixelBuffer, .readOnly)
+        defer { CVPixelBufferUnlockBaseAddress(pixelBuffer, .readOnly) }
+        guard let luma = Self.lumaPlane(of: pixelBuffer) else { return [] }
+
+        var lifted: Set<Int> = []
+        for observation in observations where observation.outline.count >= 3 {
+            var state = states[observation.classId] ?? PieceState()
+            let outline = observation.outline.map { CGPoint(x: $0.x * CGFloat(luma.width), y: $0.y * CGFloat(luma.height)) }
+            let contrasts = Self.probeScales.map { edgeContrast(of: outline, scale: $0, in: luma) }
+            guard let peakIndex = contrasts.indices.max(by: { contrasts[$0] < contrasts[$1] }),
+                  let atModel = Self.probeScales.firstIndex(of: 1.0) else { continue }
+            let apparentScale = Self.probeScales[peakIndex]
+            let peak = contrasts[peakIndex]
+
+            let tooSmall = apparentScale >= liftedScale && peak > contrasts[atModel] * 1.2
+            let blurred = state.referenceContrast.map { peak < $0 * blurRatio } ?? false
+            let moving = (observation.quality ?? 1) < movingQuality
+            // Apparent size is the only cue a piece sliding on the board cannot produce
+            let looksLifted = tooSmall && (blurred || moving)
+
+            if looksLifted {
+                state.liftedStreak += 1
+                state.onPlaneStreak = 0
+                if state.liftedStreak >= enterFrames { state.isLifted = true }
+            } else {
+                state.onPlaneStreak += 1
+                state.liftedStreak = 0
+                if state.onPlaneStreak >= exitFrames { state.isLifted = false }
+            }
+
+            // Sharpness reference comes only from still pieces whose edges sit on the model outline
+            if !state.isLifted, !looksLifted, !moving, peakIndex == atModel, observation.quality != nil {
+                state.referenceContrast = state.referenceContrast.map { $0 + referenceSmoothing * (peak - $0) } ?? peak
+            }
+
+            states[observation.classId] = state
+            if state.isLifted { lifted.insert(observation.classId) }
+        }
+        return lifted
+    }
+
+    func reset() {
+        states = [:]
+    }
+
+    // MARK: - Private Helpers
+
+    /// Mean absolute luma step across the outline's edges after scaling it about its centroid
+    private func edgeContrast(of outline: [CGPoint], scale: CGFloat, in luma: LumaPlane) -> Float {
+        let cx = outline.reduce(0) { $0 + $1.x } / CGFloat(outline.count)
+        let cy = outline.reduce(0) { $0 + $1.y } / CGFloat(outline.count)
+        let scaled = outline.map { CGPoint(x: cx + ($0.x - cx) * scale, y: cy + ($0.y - cy) * scale) }
+
+        let n = scaled.count
+        var total: Float = 0
+        var count = 0
+        for i in 0..<n {
+            let a = scaled[i], b = scaled[(i + 1) % n]
+            let length = hypot(b.x - a.x, b.y - a.y)
+            guard length > 0 else { continue }
+            var normal = CGPoint(x: (b.y - a.y) / length, y: -(b.x - a.x) / length)
+            // Point the normal away from the centroid whatever the winding
+            let mid = CGPoint(x: (a.x + b.x) / 2, y: (a.y + b.y) / 2)
+            let distance = normal.x * (mid.x - cx) + normal.y * (mid.y - cy)
+            if distance < 0 {
+                normal = CGPoint(x: -normal.x, y: -normal.y)
+            }
+            let offset = max(1.5, abs(distance) * probeOffset)
+            for k in 0..<samplesPerEdge {
+                let t = (CGFloat(k) + 0.5) / CGFloat(samplesPerEdge)
+                let p = CGPoint(x: a.x + (b.x - a.x) * t, y: a.y + (b.y - a.y) * t)
+                guard let inside = luma.value(at: CGPoint(x: p.x - normal.x * offset, y: p.y - normal.y * offset)),
+                      let outside = luma.value(at: CGPoint(x: p.x + normal.x * offset, y: p.y + normal.y * offset)) else { continue }
+                total += abs(inside - outside)
+                count += 1
+            }
+        }
+        return count > 0 ? total / Float(count) : 0
+    }
+
+    /// Y plane of biplanar buffers, green channel of BGRA; caller holds the base address lock
+    private static func lumaPlane(of pixelBuffer: CVPixelBuffer) -> LumaPlane? {
+        switch CVPixelBufferGetPixelFormatType(pixelBuffer) {
+        case kCVPixelFormatType_420YpCbCr8BiPlanarFullRange, kCVPixelFormatType_420YpCbCr8BiPlanarVideoRange:
+            guard let plane = CVPixelBufferGetBaseAddressOfPlane(pixelBuffer, 0) else { return nil }
+            return LumaPlane(
+                base: UnsafePointer(plane.assumingMemoryBound(to: UInt8.self)),
+                width: CVPixelBufferGetWidthOfPlane(pixelBuffer, 0),
+                height: CVPixelBufferGetHeightOfPlane(pixelBuffer, 0),
+                rowBytes: CVPixelBufferGetBytesPerRowOfPlane(pixelBuffer, 0),
+                pixelStride: 1
+            )
+        case kCVPixelFormatType_32BGRA:
+            guard let data = CVPixelBufferGetBaseAddress(pixelBuffer) else { return nil }
+            return LumaPlane(
+                base: UnsafePointer(data.assumingMemoryBound(to: UInt8.self)) + 1,
+                width: CVPixelBufferGetWidth(pixelBuffer),
+                height: CVPixelBufferGetHeight(pixelBuffer),
+                rowBytes: CVPixelBufferGetBytesPerRow(pixelBuffer),
+                pixelStride: 4
+            )
+        default:
+            return nil
+        }
+    }
+}
@@ -0,0 +1,159 @@
+//
+//  CVMotionDetector.swift
+//  Bemo
+//
+//  Coarse per-tile luma change detection between camera frames
+//
+
+// WHAT: Sparse-sampled mean luma per tile, compared with the previous frame and with an anchor frame (the last full pipeline run)
+// ARCHITECTURE: Owned by CVService's pipeline worker; reads the camera buffer's Y plane directly (or BGRA green)
+// USAGE: let motion = detector.update(with: cameraBuffer); changedTiles drive wake-ups, changedSinceAnchor gates skipping; anchorToLastFrame() after each run
+
+import Foundation
+import CoreGraphics
+import CoreVideo
+
+/// Between moves, nothing on the board changes. A few hundred luma samples per frame are
+/// enough to see where a hand or piece moved, so the worker can skip whole pipeline runs
+/// on still frames and reserve detection for frames (and regions) that changed.
+final class CVMotionDetector {
+
+    // MARK: - Types
+
+    struct Motion: Equatable {
+        let columns: Int
+        let rows: Int
+        /// Row-major flags, true where the tile's mean luma moved past the threshold since the previous frame
+        let changedTiles: [Bool]
+        /// Row-major flags, true where the tile moved past the threshold since the anchor frame (all true without one)
+        var changedSinceAnchor: [Bool] = []
+        /// Row-major mean luma (0...255) of each tile in this frame
+        var tileMeans: [Float] = []
+
+        var changedCount: Int { changedTiles.filter { $0 }.count }
+        var changedFraction: Double { changedTiles.isEmpty ? 1 : Double(changedCount) / Double(changedTiles.count) }
+        var isStatic: Bool { changedCount == 0 }
+        var isUnchangedSinceAnchor: Bool { !changedSinceAnchor.contains(true) }
+
+        /// Union of changed tiles in normalized buffer coordinates, nil when static
+        var changedBounds: CGRect? {
+            var bounds: CGRect?
+            for index in changedTiles.indices where changedTiles[index] {
+                let tile = CGRect(
+                    x: CGFloat(index % columns) / CGFloat(columns),
+                    y: CGFloat(index / columns) / CGFloat(rows),
+                    width: 1 / CGFloat(columns),
+                    height: 1 / CGFloat(rows)
+                )
+                bounds = bounds?.union(tile) ?? tile
+            }
+            return bounds
+        }
+    }
+
+    // MARK: - Properties
+
+    /// Tiles across the buffer's width; rows follow the aspect ratio
+    let columns: Int
+    /// Mean-luma change (0...255) that marks a tile as changed; above sensor noise, below a moving hand
+    let threshold: Float
+    /// Samples per tile side
+    private let samplesPerSide = 4
+
+    private var previousMeans: [Float] = []
+    private var previousRows = 0
+    /// Tile means of the frame results were last computed from; slow drift adds up against it
+    private var anchorMeans: [Float] = []
+
+    // MARK: - Initialization
+
+    init(columns: Int = 16, threshold: Float = 6) {
+        self.columns = columns
+        self.threshold = threshold
+    }
+
+    // MARK: - Detection
+
+    /// Compare this frame's tile means with the previous frame's and with the anchor's. The first
+    /// frame (or a size change) reports every tile as changed, as does a missing anchor.
+    func update(with pixelBuffer: CVPixelBuffer) -> Motion {
+        let means = tileMeans(of: pixelBuffer)
+        let rows = means.count / max(columns, 1)
+        defer {
+            previousMeans = means
+            previousRows = rows
+        }
+        let allChanged = [Bool](repeating: true, count: max(means.count, columns))
+        guard rows > 0, previousRows == rows, previousMeans.count == means.count else {
+            return Motion(columns: columns, rows: max(rows, 1), changedTiles: allChanged, changedSinceAnchor: allChanged, tileMeans: means)
+        }
+        let changed = zip(means, previousMeans).map { abs($0 - $1) > threshold }
+        let sinceAnchor = anchorMeans.count == means.count
+            ? zip(means, anchorMeans).map { abs($0 - $1) > threshold }
+            : allChanged
+        return Motion(columns: columns, rows: rows, changedTiles: changed, changedSinceAnchor: sinceAnchor, tileMeans: means)
+    }
+
+    /// Make the most recent frame the anchor; call when a full pipeline run used it
+    func anchorToLastFrame() {
+        anchorMeans = previousMeans
+    }
+
+    func reset() {
+        previousMeans = []
+        previousRows = 0
+        anchorMeans = []
+    }
+
+    // MARK: - Private Helpers
+
+    private func tileMeans(of pixelBuffer: CVPixelBuffer) -> [Float] {
+        CVPixelBufferLockBaseAddress(pixelBuffer, .readOnly)
+        defer { CVPixelBufferUnlockBaseAddress(pixelBuffer, .readOnly) }
+
+        let base: UnsafePointer<UInt8>
+        let width: Int, height: Int, rowBytes: Int, pixelStride: Int
+        switch CVPixelBufferGetPixelFormatType(pixelBuffer) {
+        case kCVPixelFormatType_420YpCbCr8BiPlanarFullRange, kCVPixelFormatType_420YpCbCr8BiPlanarVideoRange:
+            guard let plane = CVPixelBufferGetBaseAddressOfPlane(pixelBuffer, 0) else { return [] }
+            base = UnsafePointer(plane.assumingMemoryBound(to: UInt8.self))
+            width = CVPixelBufferGetWidthOfPlane(pixelBuffer, 0)
+            height = CVPixelBufferGetHeightOfPlane(pixelBuffer, 0)
+            rowBytes = CVPixelBufferGetBytesPerRowOfPlane(pixelBuffer, 0)
+            pixelStride = 1
+        case kCVPixelFormatType_32BGRA:
+            // Green channel tracks luma closely enough for change detection
+            guard let data = CVPixelBufferGetBaseAddress(pixelBuffer) else { return [] }
+            base = UnsafePointer(data.assumingMemoryBound(to: UInt8.self)) + 1
+            width = CVPixelBufferGetWidth(pixelBuffer)
+            height = CVPixelBufferGetHeight(pixelBuffer)
+            rowBytes = CVPixelBufferGetBytesPerRow(pixelBuffer)
+            pixelStride = 4
+        default:
+            return []
+        }
+
+        let tileSize = max(1, width / columns)
+        let rows = max(1, height / tileSize)
+        let step = max(1, tileSize / samplesPerSide)
+        var means = [Float](repeating: 0, count: columns * rows)
+        for row in 0..<rows {
+            for column in 0..<columns {
+                var sum = 0
+                var count = 0
+                var y = row * tileSize + step / 2
+                while y < min(height, (row + 1) * tileSize) {
+                    var x = column * tileSize + step / 2
+                    while x < min(width, (column + 1) * tileSize) {
+                        sum += Int(base[y * rowBytes + x * pixelStride])
+                        count += 1
+                        x += step
+                    }
+                    y += step
+                }
+                means[row * columns + column] = count > 0 ? Float(sum) / Float(count) : 0
+            }
+        }
+        return means
+    }
+}
@@ -0,0 +1,288 @@
+//
+//  CVPieceIdentityTracker.swift
+//  Bemo
+//
+//  Frame-to-frame identity for the interchangeable tangram pieces
+//
+
+// WHAT: Keeps the two large and two small triangles on stable class ids by associating detections to tracks by pose
+// ARCHITECTURE: Owned by CVService; resolves a detector-class → stable-class relabeling before results are published
+// USAGE: let remap = tracker.resolve(observations, at: captureTime); re-key polygons by remap, re-pose swapped pieces with pose(of:fittedTo:)
+
+import Foundation
+import CoreGraphics
+import simd
+
+/// The detector has to tell the two large (2/3) and two small (5/6) triangles apart from color
+/// alone, and it flips labels when lighting shifts or pieces touch. Downstream, every flip
+/// re-binds pieces to targets. Here same-shape classes form one shape class: detections are
+/// matched to the previous frame's tracks by pose distance with a tiny exhaustive assignment,
+/// and the JSON model colors only break ties between near-equal assignments.
+final class CVPieceIdentityTracker {
+
+    // MARK: - Types
+
+    /// Label-independent placement of one detection. Same-shape models are authored in different
+    /// orientations, so identity uses the posed polygon (centroid and apex direction), not the pose.
+    struct Observation {
+        /// Class id reported by the detector
+        let classId: Int
+        /// Polygon centroid in plane coordinates
+        let x: Double
+        let y: Double
+        /// Direction from centroid to the right-angle vertex
+        let theta: Double
+        /// Mean RGB sampled inside the piece, 0...255, when available
+        let color: SIMD3<Double>?
+
+        init(classId: Int, polygon: [CGPoint], color: SIMD3<Double>?) {
+            let center = CVPieceIdentityTracker.centroid(of: polygon)
+            let apex = CVPieceIdentityTracker.rightAngleVertex(of: polygon).map { polygon[$0] } ?? center
+            self.classId = classId
+            self.x = center.x
+            self.y = center.y
+            self.theta = atan2(apex.y - center.y, apex.x - center.x)
+            self.color = color
+        }
+    }
+
+    /// Model outline and color from tangram_shapes_2d.json
+    struct Model {
+        let vertices: [CGPoint]
+        let color: SIMD3<Double>
+    }
+
+    private struct Track {
+        var x: Double
+        var y: Double
+        var theta: Double
+        var lastSeen: CFTimeInterval
+    }
+
+    // MARK: - Properties
+
+    /// Classes that share a shape; identity within a group comes from tracking, not the detector
+    static let shapeGroups: [[Int]] = [[2, 3], [5, 6]]
+
+    /// Plane distance (model units) a piece can plausibly move between frames
+    private let gateDistance: Double
+    /// Plane units per radian when mixing rotation into pose distance
+    private let rotationWeight: Double
+    /// Assignments whose costs differ by less than this are decided by color
+    private let ambiguityMargin: Double
+    /// Tracks unseen for longer than this no longer constrain identity
+    private let trackLifetime: CFTimeInterval
+    /// Models by class id, for color tie-breaks and re-posing relabeled pieces
+    let models: [Int: Model]
+
+    private var tracks: [Int: Track] = [:]
+
+    // MARK: - Initialization
+
+    init(
+        models: [Int: Model] = CVPieceIdentityTracker.loadModels(),
+        gateDistance: Double = 40,
+        rotationWeight: Double = 10,
+        ambiguityMargin: Double = 4,
+        trackLifetime: CFTimeInterval = 1.0
+    ) {
+        self.models = models
+        self.gateDistance = gateDistance
+        self.rotationWeight = rotationWeight
+        self.ambiguityMargin = ambiguityMargin
+        self.trackLifetime = trackLifetime
+    }
+
+    // MARK: - Resolution
+
+    /// Stable class id for every observation's detector class id. Classes outside the shape
+    /// groups map to themselves. Updates tracks with the resolved identities.
+    func resolve(_ observations: [Observation], at time: CFTimeInterval) -> [Int: Int] {
+        tracks = tracks.filter { time - $0.value.lastSeen <= trackLifetime }
+
+        var remap: [Int: Int] = [:]
+        for observation in observations {
+            remap[observation.classId] = observation.classId
+        }
+
+        for group in Self.shapeGroups {
+            let members = observations.filter { group.contains($0.classId) }
+            guard !members.isEmpty else { continue }
+            let labels = assign(members, to: group)
+            for (observation, label) in zip(members, labels) {
+                remap[observation.classId] = label
+            }
+        }
+
+        for observation in observations {
+            guard let stable = remap[observation.classId] else { continue }
+            tracks[stable] = Track(x: observation.x, y: observation.y, theta: observation.theta, lastSeen: time)
+        }
+        return remap
+    }
+
+    func reset() {
+        tracks.removeAll()
+    }
+
+    // MARK: - Assignment
+
+    /// Cheapest injective labeling of `observations` with `labels`, enumerated exhaustively (groups have two members)
+    private func assign(_ observations: [Observation], to labels: [Int]) -> [Int] {
+        let scored = permutations(of: labels, choosing: observations.count).map { candidate in
+            var cost = 0.0
+            var colorCost = 0.0
+            for (observation, label) in zip(observations, candidate) {
+                cost += poseCost(observation, label: label)
+                colorCost += colorDistance(observation.color, label: label)
+            }
+            return (labels: candidate, cost: cost, colorCost: colorCost)
+        }
+        guard let bestCost = scored.map(\.cost).min() else { return observations.map(\.classId) }
+
+        // Among assignments within the ambiguity margin, color decides
+        return scored
+            .filter { $0.cost - bestCost < ambiguityMargin }
+            .min { $0.colorCost < $1.colorCost }?
+            .labels ?? observations.map(\.classId)
+    }
+
+    private func poseCost(_ observation: Observation, label: Int) -> Double {
+        guard let track = tracks[label] else {
+            // No history: opening a track costs the gate, so a nearby track is always preferred;
+            // keeping the detector's label is marginally cheaper than taking the other one
+            return gateDistance + (label == observation.classId ? 0 : ambiguityMargin * 0.5)
+        }
+        let dx = observation.x - track.x
+        let dy = observation.y - track.y
+        let dTheta = atan2(sin(observation.theta - track.theta), cos(observation.theta - track.theta))
+        return min(gateDistance * 2, (dx * dx + dy * dy).squareRoot() + rotationWeight * abs(dTheta))
+    }
+
+    /// Chromaticity distance so overall brightness does not matter; 0 when no color is known
+    private func colorDistance(_ color: SIMD3<Double>?, label: Int) -> Double {
+        guard let color, let expected = models[label]?.color else { return 0 }
+        let observedSum = color.x + color.y + color.z
+        let expectedSum = expected.x + expected.y + expected.z
+        guard observedSum > 1, expectedSum > 1 else { return 0 }
+        return simd_distance(color / observedSum, expected / expectedSum)
+    }
+
+    private func permutations(of labels: [Int], choosing count: Int) -> [[Int]] {
+        guard count > 0 else { return [[]] }
+        var result: [[Int]] = []
+        for (index, label) in labels.enumerated() {
+            var rest = labels
+            rest.remove(at: index)
+            for tail in permutations(of: rest, choosing: count - 1) {
+                result.append([label] + tail)
+            }
+        }
+        return result
+    }
+
+    // MARK: - Re-posing
+
+    /// Pose (R(θ)·v + t on the model's vertices) of `classId`'s model fitted to a plane polygon
+    /// reported under the other label of its shape group. Nil when the shapes do not correspond.
+    func pose(of classId: Int, fittedTo polygon: [CGPoint]) -> (x: Double, y: Double, theta: Double)? {
+        guard let model = models[classId]?.vertices,
+              model.count == polygon.count, model.count >= 3,
+              let source = Self.canonicalOrder(model),
+              let target = Self.canonicalOrder(polygon) else { return nil }
+
+        // 2D Procrustes with known correspondence
+        let sourceCenter = Self.mean(of: source)
+        let targetCenter = Self.mean(of: target)
+        var dot = 0.0, cross = 0.0
+        for (p, q) in zip(source, target) {
+            let sx = p.x - sourceCenter.x, sy = p.y - sourceCenter.y
+            let tx = q.x - targetCenter.x, ty = q.y - targetCenter.y
+            dot += sx * tx + sy * ty
+            cross += sx * ty - sy * tx
+        }
+        let theta = atan2(cross, dot)
+        let c = cos(theta), s = sin(theta)
+        return (
+            x: targetCenter.x - (sourceCenter.x * c - sourceCenter.y * s),
+            y: targetCenter.y - (sourceCenter.x * s + sourceCenter.y * c),
+            theta: theta
+        )
+    }
+
+    // MARK: - Geometry
+
+    static func centroid(of polygon: [CGPoint]) -> (x: Double, y: Double) {
+        guard !polygon.isEmpty else { return (0, 0) }
+        let sum = polygon.reduce((x: 0.0, y: 0.0)) { ($0.x + Double($1.x), $0.y + Double($1.y)) }
+        return (sum.x / Double(polygon.count), sum.y / Double(polygon.count))
+    }
+
+    /// Index of the vertex opposite the longest edge (the right angle of a tangram triangle)
+    static func rightAngleVertex(of polygon: [CGPoint]) -> Int? {
+        guard polygon.count == 3 else { return nil }
+        var best = 0
+        var longest = -1.0
+        for i in 0..<3 {
+            let a = polygon[(i + 1) % 3], b = polygon[(i + 2) % 3]
+            let length = Double(hypot(a.x - b.x, a.y - b.y))
+            if length > longest {
+                longest = length
+                best = i
+            }
+        }
+        return best
+    }
+
+    /// Counter-clockwise vertices starting at the right angle, so two posed triangles correspond index by index
+    private static func canonicalOrder(_ polygon: [CGPoint]) -> [(x: Double, y: Double)]? {
+        var points = polygon
+        var area = 0.0
+        for i in 0..<points.count {
+            let p = points[i], q = points[(i + 1) % points.count]
+            area += Double(p.x * q.y - q.x * p.y)
+        }
+        if area < 0 { points.reverse() }
+        guard let start = rightAngleVertex(of: points) else { return nil }
+        return (0..<points.count).map { k in
+            let p = points[(start + k) % points.count]
+            return (x: Double(p.x), y: Double(p.y))
+        }
+    }
+
+    private static func mean(of points: [(x: Double, y: Double)]) -> (x: Double, y: Double) {
+        let sum = points.reduce((x: 0.0, y: 0.0)) { ($0.x + $1.x, $0.y + $1.y) }
+        return (sum.x / Double(points.count), sum.y / Double(points.count))
+    }
+
+    // MARK: - Models
+
+    /// Class id → model outline and color from tangram_shapes_2d.json
+    static func loadModels(bundle: Bundle = .main) -> [Int: Model] {
+        guard let path = bundle.path(forResource: "tangram_shapes_2d", ofType: "json"),
+              let data = try? Data(contentsOf: URL(fileURLWithPath: path)),
+              let root = try? JSONSerialization.jsonObject(with: data) as? [String: Any] else {
+            return [:]
+        }
+        let idToName: [Int: String] = [
+            0: "tangram_parallelogram",
+            1: "tangram_square",
+            2: "tangram_triangle_lrg",
+            3: "tangram_triangle_lrg2",
+            4: "tangram_triangle_med",
+            5: "tangram_triangle_sml",
+            6: "tangram_triangle_sml2"
+        ]
+        var models: [Int: Model] = [:]
+        for (classId, name) in idToName {
+            guard let entry = root[name] as? [String: Any],
+                  let rgb = entry["color"] as? [NSNumber], rgb.count >= 3,
+                  let vertices = entry["vertices"] as? [[NSNumber]] else { continue }
+            models[classId] = Model(
+                vertices: vertices.compactMap { $0.count >= 2 ? CGPoint(x: $0[0].doubleValue, y: $0[1].doubleValue) : nil },
+                color: SIMD3(rgb[0].doubleValue, rgb[1].doubleValue, rgb[2].doubleValue)
+            )
+        }
+        return models
+    }
+}
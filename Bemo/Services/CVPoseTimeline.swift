@@ -0,0 +1,286 @@
+//
+//  CVPoseTimeline.swift
+//  Bemo
+//
+//  Continuous-time view of CV piece poses for display-rate rendering
+//
+
+// WHAT: Filters per-piece plane poses from each CV frame and evaluates them at any host time
+// ARCHITECTURE: Owned by CVService (written on its processingQueue), read by TangramPuzzleScene every display frame
+// USAGE: record(...) after each processed frame; posesAt(_:) / polygonsAt(_:) with CACurrentMediaTime() when rendering
+
+import Foundation
+import CoreGraphics
+import QuartzCore
+import simd
+
+/// The camera delivers 15–30 results per second while the scene draws at 60–120 Hz. Each piece
+/// carries an alpha-beta filtered pose and velocity so the renderer can interpolate between
+/// filtered states or extrapolate past the latest one by up to the measured pipeline latency.
+/// The filter's residuals also give each track a pose covariance, so consumers can decide on
+/// a placement as soon as the pose is known well enough instead of waiting out a fixed dwell.
+final class CVPoseTimeline {
+
+    // MARK: - Types
+
+    /// Rigid pose in pipeline plane coordinates
+    struct Pose: Equatable {
+        var x: Double
+        var y: Double
+        var theta: Double
+    }
+
+    /// How well a track's pose is known, in plane units and radians
+    struct Uncertainty: Equatable {
+        /// Covariance of (x, y, theta), from the recent filter residuals
+        let covariance: simd_double3x3
+        /// 0...1, falls as residuals grow relative to the piece's size
+        let quality: Double
+        /// Measurements folded into the covariance
+        let samples: Int
+
+        /// Semi-major axis of the position ellipse at the given number of standard deviations
+        func positionRadius(sigmas: Double = 2) -> Double {
+            let a = covariance[0][0], b = covariance[1][0], d = covariance[1][1]
+            let largest = (a + d) / 2 + sqrt(max(0, (a - d) * (a - d) / 4 + b * b))
+            return sigmas * sqrt(max(0, largest))
+        }
+
+        func rotationRadius(sigmas: Double = 2) -> Double {
+            sigmas * sqrt(max(0, covariance[2][2]))
+        }
+
+        /// Enough samples, and the 2σ region around a pose `positionError` / `rotationError` away from
+        /// the target lies inside the tolerances: |error| + radius ≤ tolerance on both axes
+        func isWithin(position: Double, rotation: Double, positionError: Double = 0, rotationError: Double = 0) -> Bool {
+            samples >= CVPoseTimeline.minUncertaintySamples
+                && abs(positionError) + positionRadius() <= position
+                && abs(rotationError) + rotationRadius() <= rotation
+        }
+
+        /// Enough samples, and the 2σ position region lies entirely beyond the tolerance
+        func isBeyond(position: Double, positionError: Double) -> Bool {
+            samples >= CVPoseTimeline.minUncertaintySamples
+                && abs(positionError) - positionRadius() > position
+        }
+    }
+
+    private struct State {
+        let time: CFTimeInterval
+        let pose: Pose
+        let velocity: Pose
+    }
+
+    private struct Track {
+        var previous: State?
+        var latest: State
+        /// Model polygon expressed in the piece's own frame, re-posed at query time
+        var bodyPolygon: [CGPoint]
+        /// Last time the piece was measured or confirmed in place; drives staleness
+        var lastConfirmed: CFTimeInterval
+        /// Running second moment of the (x, y, theta) residuals
+        var residualMoment = simd_double3x3()
+        var residualSamples = 0
+    }
+
+    private struct Snapshot {
+        var tracks: [Int: Track] = [:]
+        var latency: CFTimeInterval = 0
+    }
+
+    // MARK: - Properties
+
+    /// Weight of each new measurement in the filtered pose
+    private let alpha = 0.7
+    /// Weight of each new measurement's residual in the filtered velocity
+    private let beta = 0.2
+    /// Never extrapolate further than this past the latest sample, whatever the latency
+    private let maxExtrapolation: CFTimeInterval = 0.15
+    /// Tracks not seen for this long are dropped
+    private let staleAfter: CFTimeInterval = 0.5
+    private let latencySmoothing = 0.1
+    /// Weight of each new residual in the running covariance
+    private let covarianceSmoothing = 0.2
+    /// Residual RMS, as a fraction of the piece's radius, at which quality drops to 1/e
+    private let qualityScale = 0.05
+    /// Residuals needed before a covariance is reported
+    static let minUncertaintySamples = 3
+
+    // Writers replace the snapshot wholesale; readers copy it, so the lock is held only for a swap
+    private let lock = NSLock()
+    private var snapshot = Snapshot()
+
+    /// Smoothed capture-to-publish latency in seconds
+    var pipelineLatency: CFTimeInterval {
+        read().latency
+    }
+
+    // MARK: - Writing
+
+    /// Fold one processed frame into the timeline
+    /// - Parameters:
+    ///   - poses: Plane poses keyed by class id
+    ///   - polygons: Plane model polygons keyed by class id (same frame as poses)
+    ///   - captureTime: Host time the frame was exposed
+    ///   - publishedAt: Host time the result became available
+    func record(poses: [Int: Pose], polygons: [Int: [CGPoint]], captureTime: CFTimeInterval, publishedAt: CFTimeInterval) {
+        var next = read()
+
+        let measuredLatency = max(0, publishedAt - captureTime)
+        next.latency = next.latency == 0
+            ? measuredLatency
+            : next.latency + latencySmoothing * (measuredLatency - next.latency)
+
+        for (classId, measured) in poses {
+            let body = polygons[classId].map { Self.bodyFrame($0, pose: measured) }
+            guard var track = next.tracks[classId] else {
+                next.tracks[classId] = Track(
+                    previous: nil,
+                    latest: State(time: captureTime, pose: measured, velocity: Pose(x: 0, y: 0, theta: 0)),
+                    bodyPolygon: body ?? [],
+                    lastConfirmed: captureTime
+                )
+                continue
+            }
+
+            let last = track.latest
+            let dt = captureTime - last.time
+            guard dt > 0 else { continue }
+
+            // Alpha-beta filter: predict, then correct by the residual
+            let predicted = Self.advance(last.pose, by: last.velocity, dt: dt)
+            let residual = Pose(
+                x: measured.x - predicted.x,
+                y: measured.y - predicted.y,
+                theta: Self.wrap(measured.theta - predicted.theta)
+            )
+            let filtered = Pose(
+                x: predicted.x + alpha * residual.x,
+                y: predicted.y + alpha * residual.y,
+                theta: predicted.theta + alpha * residual.theta
+            )
+            let velocity = Pose(
+                x: last.velocity.x + beta * residual.x / dt,
+                y: last.velocity.y + beta * residual.y / dt,
+                theta: last.velocity.theta + beta * residual.theta / dt
+            )
+
+            let r = SIMD3(residual.x, residual.y, residual.theta)
+            let outer = simd_double3x3(rows: [r * r.x, r * r.y, r * r.z])
+            track.residualMoment = track.residualSamples == 0
+                ? outer
+                : track.residualMoment + covarianceSmoothing * (outer - track.residualMoment)
+            track.residualSamples += 1
+
+            track.previous = last
+            track.latest = State(time: captureTime, pose: filtered, velocity: velocity)
+            if let body { track.bodyPolygon = body }
+            track.lastConfirmed = captureTime
+            next.tracks[classId] = track
+        }
+
+        next.tracks = next.tracks.filter { captureTime - $0.value.lastConfirmed < staleAfter }
+        write(next)
+    }
+
+    /// Keep tracks alive that were confirmed in place without a pose measurement (e.g. by color)
+    func confirm(_ classIds: Set<Int>, at time: CFTimeInterval) {
+        guard !classIds.isEmpty else { return }
+        var next = read()
+        for classId in classIds {
+            next.tracks[classId]?.lastConfirmed = max(next.tracks[classId]?.lastConfirmed ?? 0, time)
+        }
+        write(next)
+    }
+
+    func reset() {
+        write(Snapshot())
+    }
+
+    // MARK: - Queries
+
+    /// Poses of every live track at an arbitrary host time
+    func posesAt(_ time: CFTimeInterval) -> [Int: Pose] {
+        let current = read()
+        let horizon = min(maxExtrapolation, current.latency + 1.0 / 30.0)
+        return current.tracks.mapValues { Self.evaluate($0, at: time, horizon: horizon) }
+    }
+
+    /// Model polygons re-posed at an arbitrary host time, in plane coordinates
+    func polygonsAt(_ time: CFTimeInterval) -> [Int: [CGPoint]] {
+        let current = read()
+        let horizon = min(maxExtrapolation, current.latency + 1.0 / 30.0)
+        var result: [Int: [CGPoint]] = [:]
+        for (classId, track) in current.tracks where !track.bodyPolygon.isEmpty {
+            let pose = Self.evaluate(track, at: time, horizon: horizon)
+            let c = cos(pose.theta), s = sin(pose.theta)
+            result[classId] = track.bodyPolygon.map { p in
+                CGPoint(x: pose.x + Double(p.x) * c - Double(p.y) * s,
+                        y: pose.y + Double(p.x) * s + Double(p.y) * c)
+            }
+        }
+        return result
+    }
+
+    /// Pose uncertainty of every track with enough residuals
+    func uncertainties() -> [Int: Uncertainty] {
+        read().tracks.compactMapValues { uncertainty(of: $0) }
+    }
+
+    // MARK: - Private Helpers
+
+    private func uncertainty(of track: Track) -> Uncertainty? {
+        guard track.residualSamples >= Self.minUncertaintySamples else { return nil }
+        let moment = track.residualMoment
+        let positionRMS = sqrt(max(0, moment[0][0] + moment[1][1]))
+        let radius = track.bodyPolygon.map { hypot(Double($0.x), Double($0.y)) }.max() ?? 0
+        let quality = radius > 0 ? exp(-positionRMS / (qualityScale * radius)) : 0
+        return Uncertainty(covariance: moment, quality: quality, samples: track.residualSamples)
+    }
+
+    private func read() -> Snapshot {
+        lock.lock()
+        defer { lock.unlock() }
+        return snapshot
+    }
+
+    private func write(_ next: Snapshot) {
+        lock.lock()
+        snapshot = next
+        lock.unlock()
+    }
+
+    /// Interpolate between filtered states before the latest sample, extrapolate (bounded) after it
+    private static func evaluate(_ track: Track, at time: CFTimeInterval, horizon: CFTimeInterval) -> Pose {
+        let latest = track.latest
+        if time >= latest.time {
+            return advance(latest.pose, by: latest.velocity, dt: min(time - latest.time, horizon))
+        }
+        guard let previous = track.previous, time > previous.time else {
+            return track.previous?.pose ?? latest.pose
+        }
+        let t = (time - previous.time) / (latest.time - previous.time)
+        return Pose(
+            x: previous.pose.x + (latest.pose.x - previous.pose.x) * t,
+            y: previous.pose.y + (latest.pose.y - previous.pose.y) * t,
+            theta: previous.pose.theta + wrap(latest.pose.theta - previous.pose.theta) * t
+        )
+    }
+
+    private static func advance(_ pose: Pose, by velocity: Pose, dt: Double) -> Pose {
+        Pose(x: pose.x + velocity.x * dt, y: pose.y + velocity.y * dt, theta: pose.theta + velocity.theta * dt)
+    }
+
+    /// Polygon relative to the pose: R(-θ)(p - t)
+    private static func bodyFrame(_ polygon: [CGPoint], pose: Pose) -> [CGPoint] {
+        let c = cos(-pose.theta), s = sin(-pose.theta)
+        return polygon.map { p in
+            let dx = Double(p.x) - pose.x, dy = Double(p.y) - pose.y
+            return CGPoint(x: dx * c - dy * s, y: dx * s + dy * c)
+        }
+    }
+
+    private static func wrap(_ angle: Double) -> Double {
+        atan2(sin(angle), cos(angle))
+    }
+}
@@ -0,0 +1,151 @@
+//
+//  CVPowerScheduler.swift
+//  Bemo
+//
+//  Power states for the CV pipeline and the rules for moving between them
+//
+
+// WHAT: State machine over off / watch / track / full, driven by the game's ceiling and by relevant motion
+// ARCHITECTURE: Value type owned by CVService's pipeline worker; CVService applies each state's policy per frame
+// USAGE: request(_:at:) when the game phase changes; update(relevantMotion:at:) once per processed frame
+
+import Foundation
+import QuartzCore
+
+/// Ordered from cheapest to most expensive
+enum CVPowerState: Int, CaseIterable, Comparable {
+    /// Camera stopped
+    case off
+    /// Camera at a few frames per second, tile change detection only
+    case watch
+    /// Full frame rate; still frames reuse the last result instead of running the pipeline
+    case track
+    /// Pipeline on every frame
+    case full
+
+    static func < (lhs: CVPowerState, rhs: CVPowerState) -> Bool {
+        lhs.rawValue < rhs.rawValue
+    }
+}
+
+/// Between puzzles nobody looks at CV output, and during a puzzle the board is still most of the
+/// time. The game sets a ceiling (menus: watch, play: full); below it the scheduler steps down as
+/// the scene goes still and jumps straight back to full on the first frame with relevant motion.
+struct CVPowerScheduler {
+
+    // MARK: - Types
+
+    /// What each stage of CVService does in a state
+    struct Policy: Equatable {
+        /// Camera and processing rate; 0 means the camera is stopped
+        let frameRate: Double
+        /// Convert frames and run the detector / pose pipeline
+        let runsPipeline: Bool
+        /// Still frames may reuse the previous result after a color check
+        let reusesStillResults: Bool
+    }
+
+    enum Reason: String {
+        case requested
+        case motion
+        case settled
+        case idle
+    }
+
+    struct Transition: Equatable {
+        let from: CVPowerState
+        let to: CVPowerState
+        let reason: Reason
+        let time: CFTimeInterval
+    }
+
+    struct Stats: Equatable {
+        var transitions = 0
+        var wakeUps = 0
+        /// Seconds spent in each state, up to the last transition
+        var timeInState: [CVPowerState: CFTimeInterval] = [:]
+    }
+
+    // MARK: - Properties
+
+    private(set) var state: CVPowerState = .full
+    /// Highest state the game currently wants
+    private(set) var ceiling: CVPowerState = .full
+    private(set) var stats = Stats()
+
+    /// Still time before full drops to track
+    var settleAfter: CFTimeInterval = 0.3
+    /// Still time before track drops to watch
+    var idleAfter: CFTimeInterval = 30
+    /// Capture rate while watching; low enough to save power, high enough to wake within a frame or two
+    var watchFrameRate: Double = 5
+    var activeFrameRate: Double = 30
+
+    private var lastRelevantMotion: CFTimeInterval?
+    private var enteredAt: CFTimeInterval?
+
+    // MARK: - Policies
+
+    func policy(for state: CVPowerState) -> Policy {
+        switch state {
+        case .off: return Policy(frameRate: 0, runsPipeline: false, reusesStillResults: false)
+        case .watch: return Policy(frameRate: watchFrameRate, runsPipeline: false, reusesStillResults: false)
+        case .track: return Policy(frameRate: activeFrameRate, runsPipeline: true, reusesStillResults: true)
+        case .full: return Policy(frameRate: activeFrameRate, runsPipeline: true, reusesStillResults: false)
+        }
+    }
+
+    var policy: Policy { policy(for: state) }
+
+    // MARK: - Transitions
+
+    /// Change the ceiling. Lowering it moves down at once; raising it from watch or off wakes to it,
+    /// since the game is about to need results.
+    mutating func request(_ newCeiling: CVPowerState, at time: CFTimeInterval) -> Transition? {
+        ceiling = newCeiling
+        guard newCeiling != state else { return nil }
+        if newCeiling < state || state <= .watch {
+            lastRelevantMotion = time
+            return move(to: newCeiling, reason: .requested, at: time)
+        }
+        return nil
+    }
+
+    /// Fold one processed frame in: relevant motion wakes to the ceiling, stillness steps down
+    mutating func update(relevantMotion: Bool, at time: CFTimeInterval) -> Transition? {
+        guard state != .off else { return nil }
+        if enteredAt == nil { enteredAt = time }
+        if relevantMotion {
+            lastRelevantMotion = time
+            if state < ceiling, ceiling > .watch {
+                stats.wakeUps += 1
+                return move(to: ceiling, reason: .motion, at: time)
+            }
+            return nil
+        }
+
+        let still = time - (lastRelevantMotion ?? time)
+        if lastRelevantMotion == nil { lastRelevantMotion = time }
+        switch state {
+        case .full where still >= settleAfter:
+            return move(to: .track, reason: .settled, at: time)
+        case .track where still >= idleAfter:
+            return move(to: .watch, reason: .idle, at: time)
+        default:
+            return nil
+        }
+    }
+
+    // MARK: - Private Helpers
+
+    private mutating func move(to next: CVPowerState, reason: Reason, at time: CFTimeInterval) -> Transition {
+        let transition = Transition(from: state, to: next, reason: reason, time: time)
+        if let enteredAt {
+            stats.timeInState[state, default: 0] += max(0, time - enteredAt)
+        }
+        stats.transitions += 1
+        enteredAt = time
+        state = next
+        return transition
+    }
+}
@@ -15,6 +15,7 @@ import CoreImage
 import Vision
 import AVFoundation
 import UIKit
+import simd
 
 // Wrapper to avoid issues with @Observable macro and C++ types
 private class PipelineWrapper {
@@ -26,22 +27,63 @@ class CVService: NSObject {
     // MARK: - Published Properties
     private let recognizedPiecesSubject = PassthroughSubject<[RecognizedPiece], Never>()
     private let detectionResultsSubject = PassthroughSubject<CVDetectionResult, Never>()
+    private let powerTransitionsSubject = PassthroughSubject<CVPowerScheduler.Transition, Never>()
     private var isSessionActive = false
     
     // MARK: - CV Pipeline
     private let pipelineWrapper = PipelineWrapper()
+    // Only touched on processingQueue
+    private let frameConverter = CVFrameConverter()
+    /// Filtered piece poses queryable at display rate; written on processingQueue, read from the render loop
+    let poseTimeline = CVPoseTimeline()
+    /// Latest-frame-wins handoff from the capture callback to the pipeline worker
+    private let frameMailbox = CVFrameMailbox<PendingFrame>()
+    private var lastMailboxReplacedCount = 0  // processingQueue only
+    // Keeps same-shape pieces on stable class ids; processingQueue only
+    private let identityTracker = CVPieceIdentityTracker()
+    // Per-piece chroma signatures; processingQueue only
+    private let colorVerifier = CVColorSignatureVerifier()
+    // On-plane vs held-above-board state per piece; processingQueue only
+    private let liftedClassifier = CVLiftedPieceClassifier()
+    // Sparse lens correction for the active camera, nil when uncalibrated; processingQueue only
+    private var lensModel: CVLensDistortionModel?
+    // Frame scheduling; processingQueue only
+    private let motionDetector = CVMotionDetector()
+    private let backgroundModel = CVBackgroundModel()
+    private var lastForeground: CVBackgroundModel.Foreground?
+    private var lastPipelineRun: PipelineRun?
+    private var skippedPipelineRuns = 0
+    private var loggedUnsupportedFormat = false
+    /// Longest a still scene goes without a full pipeline run
+    private let pipelineRefreshInterval: CFTimeInterval = 1.0
+    // Power state and per-stage policy; processingQueue only
+    private var powerScheduler = CVPowerScheduler()
     
     // MARK: - Camera Properties
     private var captureSession: AVCaptureSession?
+    private var captureDevice: AVCaptureDevice?
     private var videoOutput: AVCaptureVideoDataOutput?
     private let videoQueue = DispatchQueue(label: "com.bemo.cvservice.video", qos: .userInteractive)
+    private let processingQueue = DispatchQueue(label: "com.bemo.cvservice.processing", qos: .userInteractive)
     
     // MARK: - State
     private var cancellables = Set<AnyCancellable>()
     private var lastProcessingTime: TimeInterval = 0
     private var lastRecognizedPieces: [RecognizedPiece] = []
     private var lastFrameTimestamp: TimeInterval = 0
+    // Frame accounting, only touched on videoQueue
+    private var frameSequence: Int = 0
+    private var droppedFramesSinceLastResult: Int = 0
+    private var totalDroppedFrames: Int = 0
+    // Capture-side frame gate for low-rate power states, only touched on videoQueue
+    private var captureFrameInterval: CFTimeInterval = 0
+    private var lastAcceptedCaptureTime: CFTimeInterval = 0
+    private var gatedFramesSinceLastAccepted: Int = 0
+    // Clock the session stamps sample buffers with; set before the session starts running
+    private var captureClock: CMClock?
     private var currentViewSize: CGSize = UIScreen.main.bounds.size
+    /// What the pipeline needs from capture; applied on the next camera setup
+    private var captureRequirements = CVCaptureRequirements()
     private var cameraPermissionGranted: Bool = false
     
     // Public publishers
@@ -53,6 +95,11 @@ class CVService: NSObject {
         detectionResultsSubject.eraseToAnyPublisher()
     }
     
+    /// Every power state change, with its reason; delivered on the pipeline worker's queue
+    var powerTransitionsPublisher: AnyPublisher<CVPowerScheduler.Transition, Never> {
+        powerTransitionsSubject.eraseToAnyPublisher()
+    }
+    
     enum CVError: Error {
         case sessionNotActive
         case processingError
@@ -61,16 +108,109 @@ class CVService: NSObject {
         case pipelineInitializationError(String)
     }
     
+    /// Geometry of the last full pipeline run, reused to check predicted pieces on skipped frames
+    private struct PipelineRun {
+        let captureTime: CFTimeInterval
+        let homography: [Double]
+        let pipelineSize: CGSize
+        let viewSize: CGSize
+        /// Board occupancy when the run's frame was captured
+        let foreground: CVBackgroundModel.Foreground
+    }
+    
+    /// Camera frame waiting in the mailbox for the pipeline worker
+    private struct PendingFrame {
+        let cameraBuffer: CVPixelBuffer
+        let frame: CVFrameInfo
+    }
+    
+    /// One frame's pieces keyed by stable class id
+    private struct StablePieces {
+        var poses: [Int: CVPoseTimeline.Pose] = [:]
+        var polygons: [Int: [CGPoint]] = [:]
+        /// Stable class id → class id the detector reported this frame
+        var detectorClassIds: [Int: Int] = [:]
+        
+        /// Polygons in the pipeline's flat x,y layout
+        var flatPolygons: [NSNumber: [NSNumber]] {
+            var flat: [NSNumber: [NSNumber]] = [:]
+            for (classId, polygon) in polygons {
+                flat[NSNumber(value: classId)] = polygon.flatMap { [NSNumber(value: Double($0.x)), NSNumber(value: Double($0.y))] }
+            }
+            return flat
+        }
+        
+        func removing(_ classIds: Set<Int>) -> StablePieces {
+            guard !classIds.isEmpty else { return self }
+            var kept = self
+            for classId in classIds {
+                kept.poses[classId] = nil
+                kept.polygons[classId] = nil
+                kept.detectorClassIds[classId] = nil
+            }
+            return kept
+        }
+    }
+    
     struct CVDetectionResult {
         let detections: [TPDetection]
         let tangramResult: TPTangramResult?
+        /// Plane model polygons keyed by stable class id; prefer over tangramResult.planeModelPolygons.
+        /// Includes lifted pieces; check liftedPieces before treating a polygon as placed.
+        let planeModelPolygons: [NSNumber: [NSNumber]]
+        /// Stable class ids of pieces held above the board this frame; their plane geometry is approximate
+        let liftedPieces: Set<Int>
+        /// Per-piece color checks, including pieces confirmed without a detection this frame
+        let colorVerification: CVColorSignatureVerifier.Verification
+        /// Tiles that differ from the learned empty board (pieces, hands)
+        let foreground: CVBackgroundModel.Foreground
+        /// Pose covariance and residual quality per stable class id, once a track has enough residuals
+        let poseUncertainty: [Int: CVPoseTimeline.Uncertainty]
+        /// Power transitions, wake-ups and time per state so far
+        let powerStats: CVPowerScheduler.Stats
         let overlayImage: UIImage?
         let processingTimeMs: Double
         let fps: Double
+        let frame: CVFrameInfo
+    }
+    
+    /// Identity and stage timeline of one camera frame, carried from capture to the published result.
+    /// All times are host-clock seconds (same base as CACurrentMediaTime).
+    struct CVFrameInfo {
+        /// Monotonic sequence number of delivered frames in this capture session
+        let frameNumber: Int
+        /// Sample buffer presentation time
+        let captureTime: CFTimeInterval
+        /// Delivery to the capture callback
+        let receivedAt: CFTimeInterval
+        var convertedAt: CFTimeInterval = 0
+        var processedAt: CFTimeInterval = 0
+        var publishedAt: CFTimeInterval = 0
+        /// Frames dropped between the previous result and this frame, by AVFoundation or superseded in the mailbox
+        var droppedBefore: Int = 0
+        /// Frames dropped since capture started
+        var totalDropped: Int = 0
+        /// Frames thinned out by the power-state capture gate since the previous accepted frame;
+        /// they consume sequence numbers but are not drops
+        var gatedBefore: Int = 0
+        /// Still frames answered without a pipeline run since the previous result
+        var skippedBefore: Int = 0
+        /// Fraction of motion tiles that changed since the previous frame
+        var motionFraction: Double = 1
+        /// Fraction of tiles that differ from the learned empty board
+        var foregroundFraction: Double = 0
+        /// A hand or arm reaches over the board; color signatures are not learned from this frame
+        var handInView = false
+        /// Power state the frame was processed in
+        var powerState: CVPowerState = .full
+        
+        var captureToResultMs: Double { (processedAt - captureTime) * 1000 }
+        var captureToPublishMs: Double { (publishedAt - captureTime) * 1000 }
     }
     
     override init() {
         super.init()
+        powerScheduler.activeFrameRate = captureRequirements.preferredFrameRate
         setupPipeline()
     }
     
@@ -136,7 +276,7 @@ class CVService: NSObject {
         isSessionActive = false
         print("CV session stopped")
         
-        stopCamera()
+        setPowerCeiling(.off)
         
         // Clean up resources
         cancellables.removeAll()
@@ -154,6 +294,11 @@ class CVService: NSObject {
                 self.setupCamera()
             }
             self.startCamera()
+            // A feed started without a ceiling (e.g. after .off) runs at full power
+            self.processingQueue.async {
+                guard self.powerScheduler.ceiling == .off else { return }
+                self.requestPowerCeiling(.full)
+            }
         }
         
         if cameraPermissionGranted {
@@ -173,6 +318,58 @@ class CVService: NSObject {
         }
     }
     
+    // MARK: - Power States
+    
+    /// Highest power state the game needs right now; the worker steps below it while the board is
+    /// still and wakes back on motion. `.off` also stops the camera; raising the ceiling never starts
+    /// it (startVideoFeedIfNeeded does).
+    func setPowerCeiling(_ ceiling: CVPowerState) {
+        if ceiling == .off {
+            stopCamera()
+        }
+        processingQueue.async { [weak self] in
+            self?.requestPowerCeiling(ceiling)
+        }
+    }
+    
+    /// processingQueue only
+    private func requestPowerCeiling(_ ceiling: CVPowerState) {
+        if let transition = powerScheduler.request(ceiling, at: CACurrentMediaTime()) {
+            applyPowerTransition(transition)
+        }
+    }
+    
+    /// Retune capture to the new state's rate and report the change; processingQueue only
+    private func applyPowerTransition(_ transition: CVPowerScheduler.Transition) {
+        print("🔋 CV power: \(transition.from) → \(transition.to) (\(transition.reason.rawValue))")
+        setCaptureFrameRate(powerScheduler.policy(for: transition.to).frameRate)
+        powerTransitionsSubject.send(transition)
+    }
+    
+    /// Lower or restore the camera's frame rate; the capture-side gate covers rates the format cannot reach
+    private func setCaptureFrameRate(_ frameRate: Double) {
+        guard frameRate > 0 else { return }
+        videoQueue.async { [weak self] in
+            self?.captureFrameInterval = 1 / frameRate
+        }
+        DispatchQueue.main.async { [weak self] in
+            guard let device = self?.captureDevice else { return }
+            let ranges = device.activeFormat.videoSupportedFrameRateRanges
+            let lowest = ranges.map(\.minFrameRate).min() ?? frameRate
+            let highest = ranges.map(\.maxFrameRate).max() ?? frameRate
+            let rate = min(max(frameRate, lowest), highest)
+            do {
+                try device.lockForConfiguration()
+                let duration = CMTime(value: 1, timescale: CMTimeScale(rate))
+                device.activeVideoMinFrameDuration = duration
+                device.activeVideoMaxFrameDuration = duration
+                device.unlockForConfiguration()
+            } catch {
+                print("❌ Failed to change camera frame rate: \(error)")
+            }
+        }
+    }
+    
     // MARK: - Camera Setup
     
     private func setupCamera() {
@@ -185,6 +382,13 @@ class CVService: NSObject {
         }
         
         print("📱 Using camera: \(camera.localizedName)")
+        captureDevice = camera
+        // Output is mirrored below, so the bundled (unmirrored) calibration is flipped to match
+        let lensCalibration = CVLensDistortionModel.bundled(for: camera.deviceType.rawValue)
+        if lensCalibration == nil {
+            print("ℹ️ No lens calibration for \(camera.deviceType.rawValue); piece positions stay uncorrected")
+        }
+        setLensCalibration(lensCalibration?.mirrored())
         
         do {
             let input = try AVCaptureDeviceInput(device: camera)
@@ -192,11 +396,13 @@ class CVService: NSObject {
                 captureSession?.addInput(input)
             }
             
-            // Configure for highest resolution
-            configureForHighestResolution(camera)
+            // Size capture to what the pipeline needs; a preset would override the chosen format
+            let formatApplied = configureCaptureFormat(camera)
             
-            // Set session preset after adding input
-            let preferredPresets: [AVCaptureSession.Preset] = [.hd4K3840x2160, .hd1920x1080, .hd1280x720, .high]
+            // Fall back to a session preset only when no format matched
+            let preferredPresets: [AVCaptureSession.Preset] = formatApplied
+                ? []
+                : [.hd1920x1080, .hd1280x720, .high]
             for preset in preferredPresets {
                 if captureSession?.canSetSessionPreset(preset) ?? false {
                     captureSession?.sessionPreset = preset
@@ -208,9 +414,15 @@ class CVService: NSObject {
             // Video output
             videoOutput = AVCaptureVideoDataOutput()
             videoOutput?.setSampleBufferDelegate(self, queue: videoQueue)
+            // Prefer the sensor's native bi-planar YUV; CVFrameConverter produces BGRA only at pipeline size
+            let nativeFormat = CVFrameConverter.captureFormat
+            let pixelFormat = (videoOutput?.availableVideoPixelFormatTypes.contains(nativeFormat) ?? false)
+                ? nativeFormat
+                : kCVPixelFormatType_32BGRA
             videoOutput?.videoSettings = [
-                kCVPixelBufferPixelFormatTypeKey as String: kCVPixelFormatType_32BGRA
+                kCVPixelBufferPixelFormatTypeKey as String: pixelFormat
             ]
+            print("🎞️ Capture pixel format: \(pixelFormat == nativeFormat ? "420f" : "BGRA")")
             videoOutput?.alwaysDiscardsLateVideoFrames = true
             
             if captureSession?.canAddOutput(videoOutput!) ?? false {
@@ -225,6 +437,8 @@ class CVService: NSObject {
                 }
             }
             
+            captureClock = captureSession?.synchronizationClock
+            
         } catch {
             print("❌ Camera setup failed: \(error)")
         }
@@ -243,7 +457,38 @@ class CVService: NSObject {
             captureSession?.stopRunning()
         }
         captureSession = nil
+        captureDevice = nil
         videoOutput = nil
+        captureClock = nil
+        videoQueue.async { [weak self] in
+            self?.lastAcceptedCaptureTime = 0
+            self?.gatedFramesSinceLastAccepted = 0
+            self?.frameSequence = 0
+            self?.droppedFramesSinceLastResult = 0
+            self?.totalDroppedFrames = 0
+        }
+        processingQueue.async { [weak self] in
+            self?.frameMailbox.reset()
+            self?.lastMailboxReplacedCount = 0
+            self?.lastFrameTimestamp = 0
+            self?.poseTimeline.reset()
+            self?.identityTracker.reset()
+            self?.colorVerifier.reset()
+            self?.liftedClassifier.reset()
+            self?.motionDetector.reset()
+            self?.backgroundModel.reset()
+            self?.lastForeground = nil
+            self?.lastPipelineRun = nil
+            self?.skippedPipelineRuns = 0
+        }
+    }
+    
+    /// Presentation time of a sample buffer on the host clock
+    private func hostCaptureTime(of sampleBuffer: CMSampleBuffer) -> CFTimeInterval {
+        let pts = CMSampleBufferGetPresentationTimeStamp(sampleBuffer)
+        guard pts.isValid else { return CACurrentMediaTime() }
+        guard let captureClock else { return pts.seconds }
+        return CMSyncConvertTime(pts, from: captureClock, to: CMClockGetHostTimeClock()).seconds
     }
     
     // MARK: - Camera Selection Helpers
@@ -296,63 +541,92 @@ class CVService: NSObject {
         return nil
     }
     
-    private func configureForHighestResolution(_ device: AVCaptureDevice) {
+    /// Pick the smallest format that gives the pipeline enough pixels per piece at the preferred frame rate
+    /// - Returns: true when a format was applied (the session must then keep `.inputPriority`)
+    private func configureCaptureFormat(_ device: AVCaptureDevice) -> Bool {
         do {
             try device.lockForConfiguration()
             defer { device.unlockForConfiguration() }
             
-            print("🔧 Configuring camera for highest resolution...")
-            
-            // Find the highest resolution format that supports 30 FPS
-            var bestFormat: AVCaptureDevice.Format? = nil
-            var bestArea: Int32 = 0
-            
-            for format in device.formats {
+            let requirements = captureRequirements
+            let candidates = device.formats.enumerated().map { index, format in
                 let dims = CMVideoFormatDescriptionGetDimensions(format.formatDescription)
-                let area = dims.width * dims.height
-                
-                let supports30fps = format.videoSupportedFrameRateRanges.contains { range in
-                    range.minFrameRate <= 30.0 && 30.0 <= range.maxFrameRate
-                }
-                
-                if supports30fps && area > bestArea {
-                    bestArea = area
-                    bestFormat = format
-                }
+                let ranges = format.videoSupportedFrameRateRanges
+                return CVCaptureFormatSelector.Candidate(
+                    id: index,
+                    width: Int(dims.width),
+                    height: Int(dims.height),
+                    pixelFormat: CMFormatDescriptionGetMediaSubType(format.formatDescription),
+                    minFrameRate: ranges.map(\.minFrameRate).min() ?? 0,
+                    maxFrameRate: ranges.map(\.maxFrameRate).max() ?? 0
+                )
             }
             
-            if let format = bestFormat {
-                device.activeFormat = format
-                // Lock to 30 FPS
-                let desired = CMTime(value: 1, timescale: 30)
-                device.activeVideoMinFrameDuration = desired
-                device.activeVideoMaxFrameDuration = desired
-                
-                let dims = CMVideoFormatDescriptionGetDimensions(format.formatDescription)
-                print("✅ Set format: \(dims.width)x\(dims.height) @30fps")
+            guard let choice = CVCaptureFormatSelector.select(from: candidates, for: requirements) else {
+                print("⚠️ No camera format at \(Int(requirements.preferredFrameRate)) FPS; using session preset")
+                return false
             }
+            
+            device.activeFormat = device.formats[choice.id]
+            let desired = CMTime(value: 1, timescale: CMTimeScale(requirements.preferredFrameRate))
+            device.activeVideoMinFrameDuration = desired
+            device.activeVideoMaxFrameDuration = desired
+            
+            print("✅ Set format: \(choice.width)x\(choice.height) @\(Int(requirements.preferredFrameRate))fps (need short side ≥ \(requirements.requiredShortSide))")
+            return true
         } catch {
             print("❌ Failed to configure camera: \(error)")
+            return false
         }
     }
     
     // MARK: - Calibration
     
+    /// Distortion parameters for the active camera in delivered-buffer pixels; nil disables correction
+    func setLensCalibration(_ calibration: CVLensDistortionModel.Calibration?) {
+        let model = calibration.map { CVLensDistortionModel(calibration: $0) }
+        processingQueue.async { [weak self] in
+            self?.lensModel = model
+        }
+    }
+    
+    /// Measures the play area as the buffer-space extent of the pieces currently tracked on the board and
+    /// sizes the next camera setup from it. The pieces' extent never exceeds the real play area, so the
+    /// measured fraction can only ask for more pixels than needed, never fewer.
     func startCalibration() -> AnyPublisher<CalibrationResult, CVError> {
-        // Stub implementation for calibration
-        return Future<CalibrationResult, CVError> { promise in
-            DispatchQueue.main.asyncAfter(deadline: .now() + 2) {
-                let result = CalibrationResult(
-                    isSuccessful: true,
-                    playAreaBounds: CGRect(x: 0, y: 0, width: 1000, height: 1000),
-                    lightingQuality: .good
-                )
-                promise(.success(result))
+        return Future<CalibrationResult, CVError> { [weak self] promise in
+            guard let self else { return promise(.failure(.sessionNotActive)) }
+            self.processingQueue.async {
+                guard let measured = self.measuredPlayArea() else {
+                    DispatchQueue.main.async { promise(.failure(.calibrationRequired)) }
+                    return
+                }
+                DispatchQueue.main.async {
+                    self.captureRequirements = .calibrated(playAreaBounds: measured.bounds, frameSize: measured.frameSize)
+                    print("📐 CVService: Play area \(Int(measured.bounds.width))x\(Int(measured.bounds.height)) of \(Int(measured.frameSize.width))x\(Int(measured.frameSize.height)); next setup needs short side ≥ \(self.captureRequirements.requiredShortSide)")
+                    promise(.success(CalibrationResult(isSuccessful: true, playAreaBounds: measured.bounds, lightingQuality: .good)))
+                }
             }
         }
         .eraseToAnyPublisher()
     }
     
+    /// Bounds of the tracked pieces in pipeline-buffer pixels; nil without a recent run or pieces.
+    /// Runs on processingQueue.
+    private func measuredPlayArea() -> (bounds: CGRect, frameSize: CGSize)? {
+        guard let run = lastPipelineRun else { return nil }
+        let outlines = poseTimeline.polygonsAt(run.captureTime).values.compactMap {
+            normalizedOutline($0, homography: run.homography, viewSize: run.viewSize, bufferSize: run.pipelineSize)
+        }
+        let points = outlines.flatMap { $0 }
+        guard outlines.count >= 2, let minX = points.map(\.x).min(), let maxX = points.map(\.x).max(),
+              let minY = points.map(\.y).min(), let maxY = points.map(\.y).max() else { return nil }
+        let size = run.pipelineSize
+        let bounds = CGRect(x: minX * size.width, y: minY * size.height,
+                            width: (maxX - minX) * size.width, height: (maxY - minY) * size.height)
+        return (bounds.intersection(CGRect(origin: .zero, size: size)), size)
+    }
+    
     // MARK: - Frame Processing
     
     func processFrame(_ image: CIImage) {
@@ -389,29 +663,30 @@ class CVService: NSObject {
         }
     }
     
-    private func convertDetectionsToRecognizedPieces(_ result: TPCompleteResult, viewSize: CGSize) -> [RecognizedPiece] {
+    private func convertDetectionsToRecognizedPieces(_ result: TPCompleteResult, pieces stable: StablePieces, lifted: Set<Int>, viewSize: CGSize, pipelineSize: CGSize, frame: CVFrameInfo) -> [RecognizedPiece] {
         guard let tangramResult = result.tangramResult,
-              let poses = tangramResult.poses as? [NSNumber: TPPose],
               let hArray = tangramResult.h_3x3 as? [Double], hArray.count == 9 else {
             return []
         }
 
         var pieces: [RecognizedPiece] = []
         let detections = result.detections
-        let currentTimestamp = CACurrentMediaTime()
+        // Capture time, not processing time, so dt reflects real motion between exposures
+        let currentTimestamp = frame.captureTime
         let dt = (lastFrameTimestamp > 0) ? (currentTimestamp - lastFrameTimestamp) : 0
+        let captureDate = Date(timeIntervalSinceNow: frame.captureTime - CACurrentMediaTime())
 
-        for (classIdNum, pose) in poses {
-            let classId = classIdNum.intValue
+        for (classId, pose) in stable.poses {
             guard let pieceType = mapDetectionToPieceType(classId) else { continue }
 
-            let planeX = pose.tx
-            let planeY = pose.ty
+            let planeX = pose.x
+            let planeY = pose.y
 
             // Apply homography to get image coordinates
             let projectedW = hArray[6] * planeX + hArray[7] * planeY + hArray[8]
             guard abs(projectedW) > 1e-8 else { continue }
 
+            // Poses arrive lens-corrected (see undistortPieces), so H maps them straight to the corrected image
             let projectedX = (hArray[0] * planeX + hArray[1] * planeY + hArray[2]) / projectedW
             let projectedY = (hArray[3] * planeX + hArray[4] * planeY + hArray[5]) / projectedW
 
@@ -428,7 +703,8 @@ class CVService: NSObject {
             // Our RecognizedPiece expects degrees. Let's assume CCW is positive.
             let rotationDegrees = pose.theta * 180.0 / Double.pi
 
-            let confidence = detections.first { Int($0.classId) == classId }?.confidence ?? 1.0
+            let detectorClassId = stable.detectorClassIds[classId] ?? classId
+            let confidence = detections.first { Int($0.classId) == detectorClassId }?.confidence ?? 1.0
 
             // Temporarily disable velocity and isMoving to avoid affecting render positioning
             let velocity: CGVector = .zero
@@ -442,8 +718,9 @@ class CVService: NSObject {
                 velocity: velocity,
                 isMoving: isMoving,
                 confidence: Double(confidence),
-                timestamp: Date(),
-                frameNumber: 0 // TODO: Pass real frame number if available
+                timestamp: captureDate,
+                frameNumber: frame.frameNumber,
+                isLifted: lifted.contains(classId)
             )
             pieces.append(piece)
         }
@@ -453,19 +730,62 @@ class CVService: NSObject {
 
         return pieces
     }
-}
-
-// MARK: - AVCaptureVideoDataOutputSampleBufferDelegate
-
-extension CVService: AVCaptureVideoDataOutputSampleBufferDelegate {
-    func captureOutput(_ output: AVCaptureOutput, didOutput sampleBuffer: CMSampleBuffer, from connection: AVCaptureConnection) {
-        guard let pixelBuffer = CMSampleBufferGetImageBuffer(sampleBuffer),
-              let pipeline = pipelineWrapper.pipeline,
-              isSessionActive else { return }
-        
-        // Process frame through integrated pipeline
+    
+    // MARK: - Pipeline Worker
+    
+    /// Process mailbox frames until it is empty; runs on processingQueue
+    private func drainFrameMailbox() {
+        while let pending = frameMailbox.take() {
+            guard isSessionActive else { continue }
+            var frame = pending.frame
+            // Frames superseded in the mailbox count as dropped for this result
+            let replaced = frameMailbox.stats.replaced
+            frame.droppedBefore += max(0, replaced - lastMailboxReplacedCount)
+            frame.totalDropped += replaced
+            lastMailboxReplacedCount = replaced
+            process(pending.cameraBuffer, frame: frame)
+        }
+    }
+    
+    private func process(_ cameraBuffer: CVPixelBuffer, frame: CVFrameInfo) {
+        guard let pipeline = pipelineWrapper.pipeline else { return }
+        var frame = frame
         let startTime = CACurrentMediaTime()
         
+        let motion = motionDetector.update(with: cameraBuffer)
+        frame.motionFraction = motion.changedFraction
+        let foreground = backgroundModel.update(with: motion)
+        let previousForeground = lastForeground
+        lastForeground = foreground
+        frame.foregroundFraction = foreground.fraction
+        frame.handInView = foreground.handInView
+        let relevantMotion = changesTouchForeground(motion.changedTiles, foreground: foreground, previous: previousForeground)
+        if let transition = powerScheduler.update(relevantMotion: relevantMotion, at: frame.captureTime) {
+            applyPowerTransition(transition)
+        }
+        frame.powerState = powerScheduler.state
+        let policy = powerScheduler.policy
+        // Watch: change detection and background only, until motion wakes the pipeline
+        guard policy.runsPipeline else { return }
+        // Frame-to-frame stillness is not enough: a slow slide stays under the threshold every
+        // frame, so results are only reused while the board still matches the last run's frame
+        let changedSinceRun = changesTouchForeground(motion.changedSinceAnchor, foreground: foreground, previous: lastPipelineRun?.foreground)
+        if policy.reusesStillResults, !relevantMotion, !changedSinceRun, canSkipPipeline(cameraBuffer: cameraBuffer, at: frame.captureTime) {
+            skippedPipelineRuns += 1
+            return
+        }
+        frame.skippedBefore = skippedPipelineRuns
+        skippedPipelineRuns = 0
+        
+        guard let pixelBuffer = frameConverter.pipelineBuffer(from: cameraBuffer) else {
+            if !loggedUnsupportedFormat {
+                loggedUnsupportedFormat = true
+                print("❌ Unsupported capture pixel format \(CVPixelBufferGetPixelFormatType(cameraBuffer))")
+            }
+            return
+        }
+        frame.convertedAt = CACurrentMediaTime()
+        
         let options = TPTangramOptions()
         options.renderOverlays = true
         options.lockingEnabled = true
@@ -481,12 +801,49 @@ extension CVService: AVCaptureVideoDataOutputSampleBufferDelegate {
                 options: options
             )
             
-            let processingTime = (CACurrentMediaTime() - startTime) * 1000
+            frame.processedAt = CACurrentMediaTime()
+            let processingTime = (frame.processedAt - startTime) * 1000
             let fps = 1000.0 / processingTime
             
             // Publish recognized pieces as-is only if caller needs them
             // Keep publishing for game logic; do not apply additional homography transforms here
-            let recognizedPieces = convertDetectionsToRecognizedPieces(result, viewSize: viewSize)
+            let resolvedPieces = resolveStablePieces(result.tangramResult, pixelBuffer: pixelBuffer, viewSize: viewSize, frame: frame)
+            let homography = (result.tangramResult?.h_3x3 as? [Double]).flatMap { $0.count == 9 ? $0 : nil }
+            let pipelineSize = CGSize(width: CVPixelBufferGetWidth(pixelBuffer), height: CVPixelBufferGetHeight(pixelBuffer))
+            // Held pieces project at the wrong scale; they are published flagged but kept out of plane-based updates
+            let liftedPieces = classifyLiftedPieces(
+                resolvedPieces,
+                homography: homography,
+                cameraBuffer: cameraBuffer,
+                pipelineSize: pipelineSize,
+                viewSize: viewSize
+            )
+            let stablePieces = resolvedPieces.removing(liftedPieces)
+            let colorVerification = verifyColorSignatures(
+                stablePieces,
+                homography: homography,
+                cameraBuffer: cameraBuffer,
+                pipelineSize: pipelineSize,
+                viewSize: viewSize,
+                learning: !foreground.handInView,
+                frame: frame
+            )
+            lastPipelineRun = homography.map {
+                PipelineRun(captureTime: frame.captureTime, homography: $0, pipelineSize: pipelineSize, viewSize: viewSize, foreground: foreground)
+            }
+            motionDetector.anchorToLastFrame()
+            // Pieces the detector missed but whose color is still in place stay on the timeline
+            poseTimeline.confirm(colorVerification.verifiedWithoutDetection, at: frame.captureTime)
+            // Pixel sampling above needs the distorted geometry; everything published below is corrected
+            let correctedPieces = undistortPieces(resolvedPieces, homography: homography, viewSize: viewSize, bufferSize: pipelineSize)
+            let recognizedPieces = convertDetectionsToRecognizedPieces(
+                result,
+                pieces: correctedPieces,
+                lifted: liftedPieces,
+                viewSize: viewSize,
+                pipelineSize: pipelineSize,
+                frame: frame
+            )
             recognizedPiecesSubject.send(recognizedPieces)
             
             // Create overlay image if available
@@ -500,12 +857,21 @@ extension CVService: AVCaptureVideoDataOutputSampleBufferDelegate {
             }
             
             // Publish full detection results (includes tangramResult for model polygons)
+            frame.publishedAt = CACurrentMediaTime()
+            recordPoses(correctedPieces.removing(liftedPieces), frame: frame)
             let detectionResult = CVDetectionResult(
                 detections: result.detections,
                 tangramResult: result.tangramResult,
+                planeModelPolygons: correctedPieces.flatPolygons,
+                liftedPieces: liftedPieces,
+                colorVerification: colorVerification,
+                foreground: foreground,
+                poseUncertainty: poseTimeline.uncertainties(),
+                powerStats: powerScheduler.stats,
                 overlayImage: overlayImage,
                 processingTimeMs: processingTime,
-                fps: fps
+                fps: fps,
+                frame: frame
             )
             
             detectionResultsSubject.send(detectionResult)
@@ -526,6 +892,295 @@ extension CVService: AVCaptureVideoDataOutputSampleBufferDelegate {
             print("❌ Processing error: \(error)")
         }
     }
+    
+    // MARK: - Piece Identity
+    
+    /// Relabel the frame's poses and plane polygons onto stable class ids, so same-shape pieces
+    /// keep their identity when the detector swaps 2/3 or 5/6
+    private func resolveStablePieces(_ tangramResult: TPTangramResult?, pixelBuffer: CVPixelBuffer, viewSize: CGSize, frame: CVFrameInfo) -> StablePieces {
+        guard let tangramResult,
+              let poses = tangramResult.poses as? [NSNumber: TPPose] else { return StablePieces() }
+        
+        var polygons: [Int: [CGPoint]] = [:]
+        if let planePolygons = tangramResult.planeModelPolygons as? [NSNumber: [NSNumber]] {
+            for (classId, flat) in planePolygons where flat.count >= 6 {
+                polygons[classId.intValue] = stride(from: 0, to: flat.count - 1, by: 2).map {
+                    CGPoint(x: flat[$0].doubleValue, y: flat[$0 + 1].doubleValue)
+                }
+            }
+        }
+        
+        let homography = (tangramResult.h_3x3 as? [Double]).flatMap { $0.count == 9 ? $0 : nil }
+        let observations: [CVPieceIdentityTracker.Observation] = polygons.map { classId, polygon in
+            let center = CVPieceIdentityTracker.centroid(of: polygon)
+            let color = homography.flatMap {
+                sampleColor(in: pixelBuffer, atPlanePoint: CGPoint(x: center.x, y: center.y), homography: $0, viewSize: viewSize)
+            }
+            return CVPieceIdentityTracker.Observation(classId: classId, polygon: polygon, color: color)
+        }
+        let remap = identityTracker.resolve(observations, at: frame.captureTime)
+        
+        var stable = StablePieces()
+        for (classIdNum, pose) in poses {
+            let detectorClassId = classIdNum.intValue
+            let stableClassId = remap[detectorClassId] ?? detectorClassId
+            var stablePose = CVPoseTimeline.Pose(x: Double(pose.tx), y: Double(pose.ty), theta: Double(pose.theta))
+            if stableClassId != detectorClassId, let polygon = polygons[detectorClassId] {
+                // Same-shape models are authored in different orientations: re-fit the stable model to the piece
+                guard let fitted = identityTracker.pose(of: stableClassId, fittedTo: polygon) else { continue }
+                stablePose = CVPoseTimeline.Pose(x: fitted.x, y: fitted.y, theta: fitted.theta)
+            }
+            stable.poses[stableClassId] = stablePose
+            stable.detectorClassIds[stableClassId] = detectorClassId
+            if let polygon = polygons[detectorClassId] {
+                stable.polygons[stableClassId] = polygon
+            }
+        }
+        return stable
+    }
+    
+    /// Plane point → [0, 1] buffer coordinates. The pipeline image is the bottom-cropped square of
+    /// the frame, in view-size units (see convertDetectionsToRecognizedPieces).
+    private func normalizedBufferPoint(forPlanePoint point: CGPoint, homography h: [Double], viewSize: CGSize, bufferSize: CGSize) -> CGPoint? {
+        guard viewSize.width > 0, bufferSize.width > 0, bufferSize.height > 0 else { return nil }
+        let w = h[6] * point.x + h[7] * point.y + h[8]
+        guard abs(w) > 1e-8 else { return nil }
+        let imageX = (h[0] * point.x + h[1] * point.y + h[2]) / w
+        let imageY = (h[3] * point.x + h[4] * point.y + h[5]) / w
+        
+        let scale = bufferSize.width / viewSize.width
+        let cropTop = max(0, bufferSize.height - bufferSize.width)
+        return CGPoint(x: imageX * scale / bufferSize.width, y: (imageY * scale + cropTop) / bufferSize.height)
+    }
+    
+    /// Lens-corrected copy of the frame's pieces. The native homography is fitted to distorted image
+    /// points, so each plane point goes to the image through H, is undistorted there and comes back
+    /// through H⁻¹: published polygons, timeline poses and recognized positions (H · pose) then all
+    /// describe the same corrected geometry. Unchanged without a distortion model.
+    private func undistortPieces(_ pieces: StablePieces, homography: [Double]?, viewSize: CGSize, bufferSize: CGSize) -> StablePieces {
+        guard lensModel != nil, let h = homography else { return pieces }
+        let forward = simd_double3x3(rows: [SIMD3(h[0], h[1], h[2]), SIMD3(h[3], h[4], h[5]), SIMD3(h[6], h[7], h[8])])
+        guard abs(forward.determinant) > 1e-12 else { return pieces }
+        let inverse = forward.inverse
+        
+        func correct(_ point: CGPoint) -> CGPoint {
+            let image = forward * SIMD3(Double(point.x), Double(point.y), 1)
+            guard abs(image.z) > 1e-8 else { return point }
+            let undistorted = undistortImagePoint(CGPoint(x: image.x / image.z, y: image.y / image.z), viewSize: viewSize, bufferSize: bufferSize)
+            let plane = inverse * SIMD3(Double(undistorted.x), Double(undistorted.y), 1)
+            guard abs(plane.z) > 1e-8 else { return point }
+            return CGPoint(x: plane.x / plane.z, y: plane.y / plane.z)
+        }
+        
+        var corrected = pieces
+        for (classId, polygon) in pieces.polygons {
+            corrected.polygons[classId] = polygon.map(correct)
+        }
+        for (classId, pose) in pieces.poses {
+            let center = correct(CGPoint(x: pose.x, y: pose.y))
+            // Distortion is locally close to rigid; carry its small turn over to theta
+            let turn = pieces.polygons[classId].flatMap { polygon in
+                corrected.polygons[classId].map { Self.meanTurn(from: polygon, to: $0) }
+            } ?? 0
+            corrected.poses[classId] = CVPoseTimeline.Pose(x: Double(center.x), y: Double(center.y), theta: pose.theta + turn)
+        }
+        return corrected
+    }
+    
+    /// Mean rotation of a polygon's vertices about its centroid between two versions of it
+    private static func meanTurn(from original: [CGPoint], to moved: [CGPoint]) -> Double {
+        guard original.count == moved.count, !original.isEmpty else { return 0 }
+        let a = CVPieceIdentityTracker.centroid(of: original)
+        let b = CVPieceIdentityTracker.centroid(of: moved)
+        let turns = zip(original, moved).map { p, q in
+            let before = atan2(Double(p.y) - a.y, Double(p.x) - a.x)
+            let after = atan2(Double(q.y) - b.y, Double(q.x) - b.x)
+            return atan2(sin(after - before), cos(after - before))
+        }
+        return turns.reduce(0, +) / Double(turns.count)
+    }
+    
+    /// Lens-corrected pipeline image point (view-size units), unchanged without a distortion model
+    private func undistortImagePoint(_ point: CGPoint, viewSize: CGSize, bufferSize: CGSize) -> CGPoint {
+        guard let lensModel, viewSize.width > 0, bufferSize.width > 0, bufferSize.height > 0 else { return point }
+        let scale = bufferSize.width / viewSize.width
+        let cropTop = max(0, bufferSize.height - bufferSize.width)
+        let normalized = CGPoint(x: point.x * scale / bufferSize.width, y: (point.y * scale + cropTop) / bufferSize.height)
+        let corrected = lensModel.undistort(normalized)
+        return CGPoint(x: corrected.x * bufferSize.width / scale, y: (corrected.y * bufferSize.height - cropTop) / scale)
+    }
+    
+    /// Mean color of a small patch around a plane point
+    private func sampleColor(in pixelBuffer: CVPixelBuffer, atPlanePoint point: CGPoint, homography h: [Double], viewSize: CGSize) -> SIMD3<Double>? {
+        guard CVPixelBufferGetPixelFormatType(pixelBuffer) == kCVPixelFormatType_32BGRA else { return nil }
+        let width = CVPixelBufferGetWidth(pixelBuffer)
+        let height = CVPixelBufferGetHeight(pixelBuffer)
+        guard let normalized = normalizedBufferPoint(
+            forPlanePoint: point,
+            homography: h,
+            viewSize: viewSize,
+            bufferSize: CGSize(width: width, height: height)
+        ) else { return nil }
+        let px = Int(normalized.x * CGFloat(width))
+        let py = Int(normalized.y * CGFloat(height))
+        let radius = 2
+        guard px >= radius, py >= radius, px < width - radius, py < height - radius else { return nil }
+        
+        CVPixelBufferLockBaseAddress(pixelBuffer, .readOnly)
+        defer { CVPixelBufferUnlockBaseAddress(pixelBuffer, .readOnly) }
+        guard let base = CVPixelBufferGetBaseAddress(pixelBuffer)?.assumingMemoryBound(to: UInt8.self) else { return nil }
+        let rowBytes = CVPixelBufferGetBytesPerRow(pixelBuffer)
+        
+        var sum = SIMD3<Double>(repeating: 0)
+        for y in (py - radius)...(py + radius) {
+            for x in (px - radius)...(px + radius) {
+                let pixel = base + y * rowBytes + x * 4
+                sum += SIMD3(Double(pixel[2]), Double(pixel[1]), Double(pixel[0]))
+            }
+        }
+        return sum / Double((2 * radius + 1) * (2 * radius + 1))
+    }
+    
+    // MARK: - Lifted Pieces
+    
+    /// Pieces whose outline, sharpness and motion say they are held above the board
+    private func classifyLiftedPieces(_ pieces: StablePieces, homography: [Double]?, cameraBuffer: CVPixelBuffer, pipelineSize: CGSize, viewSize: CGSize) -> Set<Int> {
+        guard let homography else { return [] }
+        let uncertainties = poseTimeline.uncertainties()
+        let observations: [CVLiftedPieceClassifier.Observation] = pieces.polygons.compactMap { classId, polygon in
+            guard let outline = normalizedOutline(polygon, homography: homography, viewSize: viewSize, bufferSize: pipelineSize) else { return nil }
+            return CVLiftedPieceClassifier.Observation(classId: classId, outline: outline, quality: uncertainties[classId]?.quality)
+        }
+        return liftedClassifier.classify(observations, in: cameraBuffer)
+    }
+    
+    // MARK: - Color Signatures
+    
+    /// Check each piece's colors against its signature: detected pieces inside their measured outline
+    /// (learning as they go unless a hand may cover them), missed pieces inside the outline the
+    /// timeline predicts for this frame
+    private func verifyColorSignatures(_ pieces: StablePieces, homography: [Double]?, cameraBuffer: CVPixelBuffer, pipelineSize: CGSize, viewSize: CGSize, learning: Bool, frame: CVFrameInfo) -> CVColorSignatureVerifier.Verification {
+        var verification = CVColorSignatureVerifier.Verification()
+        guard let homography else { return verification }
+        
+        func normalized(_ polygon: [CGPoint]) -> [CGPoint]? {
+            normalizedOutline(polygon, homography: homography, viewSize: viewSize, bufferSize: pipelineSize)
+        }
+        
+        for (classId, polygon) in pieces.polygons {
+            guard let outline = normalized(polygon) else { continue }
+            let similarity = learning
+                ? colorVerifier.learn(classId, polygon: outline, in: cameraBuffer)
+                : colorVerifier.verify(classId, polygon: outline, in: cameraBuffer)
+            guard let similarity else { continue }
+            if similarity >= colorVerifier.acceptSimilarity {
+                verification.confirmed.insert(classId)
+            } else {
+                verification.mismatched.insert(classId)
+            }
+        }
+        
+        // Timeline polygons are lens-corrected, unlike this frame's detections; distort them back first
+        for (classId, polygon) in poseTimeline.polygonsAt(frame.captureTime) where pieces.polygons[classId] == nil {
+            guard let corrected = normalized(polygon) else { continue }
+            let outline = lensModel.map { model in corrected.map(model.distort) } ?? corrected
+            guard let similarity = colorVerifier.verify(classId, polygon: outline, in: cameraBuffer),
+                  similarity >= colorVerifier.acceptSimilarity else { continue }
+            verification.verifiedWithoutDetection.insert(classId)
+        }
+        return verification
+    }
+    
+    /// Plane polygon → normalized buffer coordinates, nil if any vertex fails to project
+    private func normalizedOutline(_ polygon: [CGPoint], homography: [Double], viewSize: CGSize, bufferSize: CGSize) -> [CGPoint]? {
+        let points = polygon.compactMap {
+            normalizedBufferPoint(forPlanePoint: $0, homography: homography, viewSize: viewSize, bufferSize: bufferSize)
+        }
+        return points.count == polygon.count ? points : nil
+    }
+    
+    // MARK: - Scheduling
+    
+    /// Changes matter only where something sits on the board now or did at the reference frame;
+    /// changes on tiles that match the empty board in both (light flicker, table edges) cannot move a piece
+    private func changesTouchForeground(_ changedTiles: [Bool], foreground: CVBackgroundModel.Foreground, previous: CVBackgroundModel.Foreground?) -> Bool {
+        guard let previous, foreground.mask.count == changedTiles.count, previous.mask.count == changedTiles.count else {
+            return changedTiles.contains(true)
+        }
+        return changedTiles.indices.contains { index in
+            changedTiles[index] && (foreground.mask[index] || previous.mask[index])
+        }
+    }
+    
+    /// A frame without relevant motion needs no pipeline run when a full run happened recently and
+    /// every tracked piece still shows its own color where the timeline predicts it (detector-free check)
+    private func canSkipPipeline(cameraBuffer: CVPixelBuffer, at time: CFTimeInterval) -> Bool {
+        guard let run = lastPipelineRun,
+              time - run.captureTime < pipelineRefreshInterval else { return false }
+        
+        for (classId, polygon) in poseTimeline.polygonsAt(time) {
+            guard let corrected = normalizedOutline(polygon, homography: run.homography, viewSize: run.viewSize, bufferSize: run.pipelineSize) else { return false }
+            // Timeline polygons are lens-corrected; put them back where the camera sees them
+            let outline = lensModel.map { model in corrected.map(model.distort) } ?? corrected
+            guard let similarity = colorVerifier.verify(classId, polygon: outline, in: cameraBuffer),
+                  similarity >= colorVerifier.acceptSimilarity else { return false }
+        }
+        return true
+    }
+    
+    /// Feed the frame's plane poses and model polygons into the display-rate timeline
+    private func recordPoses(_ pieces: StablePieces, frame: CVFrameInfo) {
+        poseTimeline.record(
+            poses: pieces.poses,
+            polygons: pieces.polygons,
+            captureTime: frame.captureTime,
+            publishedAt: frame.publishedAt
+        )
+    }
+}
+
+// MARK: - AVCaptureVideoDataOutputSampleBufferDelegate
+
+extension CVService: AVCaptureVideoDataOutputSampleBufferDelegate {
+    func captureOutput(_ output: AVCaptureOutput, didOutput sampleBuffer: CMSampleBuffer, from connection: AVCaptureConnection) {
+        frameSequence += 1
+        guard let cameraBuffer = CMSampleBufferGetImageBuffer(sampleBuffer),
+              pipelineWrapper.pipeline != nil,
+              isSessionActive else { return }
+        
+        // Low-rate power states thin the feed further when the camera cannot slow down enough
+        let captureTime = hostCaptureTime(of: sampleBuffer)
+        guard captureTime - lastAcceptedCaptureTime >= captureFrameInterval * 0.9 else {
+            gatedFramesSinceLastAccepted += 1
+            return
+        }
+        lastAcceptedCaptureTime = captureTime
+        
+        // Hand off without waiting; the worker always picks up the newest frame
+        let frame = CVFrameInfo(
+            frameNumber: frameSequence,
+            captureTime: captureTime,
+            receivedAt: CACurrentMediaTime(),
+            droppedBefore: droppedFramesSinceLastResult,
+            totalDropped: totalDroppedFrames,
+            gatedBefore: gatedFramesSinceLastAccepted
+        )
+        droppedFramesSinceLastResult = 0
+        gatedFramesSinceLastAccepted = 0
+        
+        if frameMailbox.post(PendingFrame(cameraBuffer: cameraBuffer, frame: frame)) {
+            processingQueue.async { [weak self] in
+                self?.drainFrameMailbox()
+            }
+        }
+    }
+    
+    func captureOutput(_ output: AVCaptureOutput, didDrop sampleBuffer: CMSampleBuffer, from connection: AVCaptureConnection) {
+        // Late frames discarded by AVFoundation still consume a sequence number so gaps stay visible
+        frameSequence += 1
+        droppedFramesSinceLastResult += 1
+        totalDroppedFrames += 1
+    }
 }
 
 // MARK: - Supporting Types
@@ -22,6 +22,7 @@ struct RecognizedPiece: Identifiable {
     let confidence: Double // 0.0 to 1.0
     let timestamp: Date
     let frameNumber: Int // For frame-to-frame tracking
+    var isLifted = false // Held above the board; position is approximate and not a placement
     
     // Legacy shape/color enums kept for backward compatibility with other games
     var shape: Shape {
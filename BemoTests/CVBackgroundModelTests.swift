@@ -0,0 +1,60 @@
+//
+//  CVBackgroundModelTests.swift
+//  BemoTests
+//
+//  Unit tests for the learned empty-board background model
+//
+
+import XCTest
+@testable import Bemo
+
+final class CVBackgroundModelTests: XCTestCase {
+
+    private let columns = 8
+    private let rows = 8
+
+    private func motion(_ means: [Float], changed: Set<Int> = []) -> CVMotionDetector.Motion {
+        CVMotionDetector.Motion(
+            columns: columns,
+            rows: rows,
+            changedTiles: means.indices.map { changed.contains($0) },
+            tileMeans: means
+        )
+    }
+
+    // MARK: - Foreground Tests
+
+    func testPlacedPieceStaysForegroundUnderExposureChange() {
+        let model = CVBackgroundModel()
+        let board = [Float](repeating: 100, count: columns * rows)
+        XCTAssertEqual(model.update(with: motion(board)).count, 0)
+
+        // A piece lands in the middle, then sits still while exposure brightens everything by 20%
+        var withPiece = board
+        withPiece[27] = 200
+        let landed = model.update(with: motion(withPiece, changed: [27]))
+        XCTAssertEqual(landed.count, 1)
+        XCTAssertTrue(landed.mask[27])
+        let brighter = withPiece.map { $0 * 1.2 }
+        for _ in 0..<50 {
+            let foreground = model.update(with: motion(brighter))
+            XCTAssertEqual(foreground.count, 1)
+            XCTAssertTrue(foreground.mask[27])
+            XCTAssertFalse(foreground.handInView)
+        }
+    }
+
+    func testLargeRegionFromBorderIsHand() {
+        let model = CVBackgroundModel()
+        let board = [Float](repeating: 100, count: columns * rows)
+        _ = model.update(with: motion(board))
+
+        // An arm covering the bottom two rows from the left edge inward
+        var withArm = board
+        let arm = Set((0..<4).flatMap { [6 * columns + $0, 7 * columns + $0] })
+        for index in arm { withArm[index] = 180 }
+        let foreground = model.update(with: motion(withArm, changed: arm))
+        XCTAssertTrue(foreground.handInView)
+        XCTAssertEqual(foreground.count, arm.count)
+    }
+}
@@ -0,0 +1,78 @@
+//
+//  CVCaptureFormatSelectorTests.swift
+//  BemoTests
+//
+//  Unit tests for requirement-driven camera format selection
+//
+
+import XCTest
+import CoreVideo
+@testable import Bemo
+
+final class CVCaptureFormatSelectorTests: XCTestCase {
+
+    private let yuv = kCVPixelFormatType_420YpCbCr8BiPlanarFullRange
+    private let yuvVideoRange = kCVPixelFormatType_420YpCbCr8BiPlanarVideoRange
+
+    private func candidate(_ id: Int, _ width: Int, _ height: Int, format: OSType? = nil, maxFPS: Double = 30) -> CVCaptureFormatSelector.Candidate {
+        CVCaptureFormatSelector.Candidate(
+            id: id, width: width, height: height,
+            pixelFormat: format ?? yuv,
+            minFrameRate: 1, maxFrameRate: maxFPS
+        )
+    }
+
+    // MARK: - Selection Tests
+
+    func testPicksSmallestFormatMeetingRequirement() {
+        let candidates = [
+            candidate(0, 3840, 2160),
+            candidate(1, 1920, 1080),
+            candidate(2, 1280, 720),
+            candidate(3, 640, 480)
+        ]
+        // Unmeasured play area: hold the 1080p floor
+        XCTAssertEqual(CVCaptureFormatSelector.select(from: candidates, for: CVCaptureRequirements())?.id, 1)
+
+        // A board filling 90% of a 1080p frame needs 48 / (0.12 · 0.9) ≈ 445 px
+        let measured = CVCaptureRequirements.calibrated(
+            playAreaBounds: CGRect(x: 420, y: 54, width: 1080, height: 972),
+            frameSize: CGSize(width: 1920, height: 1080)
+        )
+        XCTAssertEqual(measured.playAreaFraction ?? 0, 0.9, accuracy: 1e-9)
+        XCTAssertEqual(measured.requiredShortSide, 445)
+        XCTAssertEqual(CVCaptureFormatSelector.select(from: candidates, for: measured)?.id, 3)
+    }
+
+    func testDegenerateCalibrationKeepsFloor() {
+        let requirements = CVCaptureRequirements.calibrated(playAreaBounds: .zero, frameSize: CGSize(width: 1920, height: 1080))
+        XCTAssertNil(requirements.playAreaFraction)
+        XCTAssertEqual(requirements.requiredShortSide, 1080)
+    }
+
+    func testSmallPlayAreaNeedsMorePixelsButNeverBeyondPipelineSize() {
+        var requirements = CVCaptureRequirements()
+        requirements.playAreaFraction = 0.25  // needs a 1600 px short side, unreachable after downscale
+        let candidates = [
+            candidate(0, 3840, 2160),
+            candidate(1, 1920, 1080),
+            candidate(2, 1280, 720)
+        ]
+
+        // 4K downscales to 1920×1080 anyway, so the native 1080p format wins
+        XCTAssertEqual(CVCaptureFormatSelector.select(from: candidates, for: requirements)?.id, 1)
+    }
+
+    func testRequiresFrameRateAndPrefersPipelinePixelFormat() {
+        let candidates = [
+            candidate(0, 1280, 720, maxFPS: 24),
+            candidate(1, 1920, 1080, format: yuvVideoRange),
+            candidate(2, 1920, 1080)
+        ]
+        XCTAssertEqual(CVCaptureFormatSelector.select(from: candidates, for: CVCaptureRequirements())?.id, 2)
+
+        var fast = CVCaptureRequirements()
+        fast.preferredFrameRate = 60
+        XCTAssertNil(CVCaptureFormatSelector.select(from: candidates, for: fast))
+    }
+}
@@ -0,0 +1,56 @@
+//
+//  CVColorSignatureVerifierTests.swift
+//  BemoTests
+//
+//  Unit tests for chroma-signature piece verification
+//
+
+import XCTest
+import CoreVideo
+@testable import Bemo
+
+final class CVColorSignatureVerifierTests: XCTestCase {
+
+    /// 64×64 BGRA buffer, left half red, right half blue
+    private func makeSplitBuffer() throws -> CVPixelBuffer {
+        try CVPixelBufferFixture.bgra(width: 64, height: 64) { x, _ in
+            x < 32 ? (r: 220, g: 10, b: 20) : (r: 15, g: 10, b: 210)
+        }
+    }
+
+    // MARK: - Verification Tests
+
+    func testSignatureMatchesOwnColorOnly() throws {
+        let buffer = try makeSplitBuffer()
+        let verifier = CVColorSignatureVerifier()
+        let left = [CGPoint(x: 0.1, y: 0.1), CGPoint(x: 0.4, y: 0.1), CGPoint(x: 0.1, y: 0.9)]
+        let right = left.map { CGPoint(x: $0.x + 0.5, y: $0.y) }
+
+        XCTAssertNil(verifier.learn(2, polygon: left, in: buffer))
+
+        let same = try XCTUnwrap(verifier.verify(2, polygon: left, in: buffer))
+        let other = try XCTUnwrap(verifier.verify(2, polygon: right, in: buffer))
+        XCTAssertGreaterThan(same, verifier.acceptSimilarity)
+        XCTAssertLessThan(other, verifier.acceptSimilarity)
+        XCTAssertNil(verifier.verify(3, polygon: left, in: buffer))
+    }
+
+    // MARK: - Color Matrix Tests
+
+    func testBGRAChromaFollowsTheBufferColorMatrix() throws {
+        let triangle = [CGPoint(x: 0.1, y: 0.1), CGPoint(x: 0.9, y: 0.1), CGPoint(x: 0.1, y: 0.9)]
+        let verifier = CVColorSignatureVerifier()
+        func dominantBin(_ buffer: CVPixelBuffer) throws -> Int {
+            let histogram = try XCTUnwrap(verifier.histogram(inside: triangle, in: buffer))
+            return try XCTUnwrap(histogram.indices.max { histogram[$0] < histogram[$1] })
+        }
+
+        // Pure red: Cr saturates under both matrices, Cb is 85 under BT.601 and 99 under BT.709
+        let untagged = try CVPixelBufferFixture.bgra(width: 16, height: 16) { _, _ in (r: 255, g: 0, b: 0) }
+        XCTAssertEqual(try dominantBin(untagged), 7 * CVColorSignatureVerifier.bins + 2)
+
+        let tagged = try CVPixelBufferFixture.bgra(width: 16, height: 16) { _, _ in (r: 255, g: 0, b: 0) }
+        CVBufferSetAttachment(tagged, kCVImageBufferYCbCrMatrixKey, kCVImageBufferYCbCrMatrix_ITU_R_709_2, .shouldPropagate)
+        XCTAssertEqual(try dominantBin(tagged), 7 * CVColorSignatureVerifier.bins + 3)
+    }
+}
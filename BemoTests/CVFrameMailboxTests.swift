@@ -0,0 +1,39 @@
+//
+//  CVFrameMailboxTests.swift
+//  BemoTests
+//
+//  Unit tests for the latest-frame-wins capture handoff
+//
+
+import XCTest
+@testable import Bemo
+
+final class CVFrameMailboxTests: XCTestCase {
+
+    // MARK: - Handoff Tests
+
+    func testWorkerTakesNewestFrameAndCountsReplacements() {
+        let mailbox = CVFrameMailbox<Int>()
+
+        XCTAssertTrue(mailbox.post(1))
+        XCTAssertFalse(mailbox.post(2))
+        XCTAssertFalse(mailbox.post(3))
+
+        XCTAssertEqual(mailbox.take(), 3)
+        XCTAssertNil(mailbox.take())
+        XCTAssertEqual(mailbox.stats, CVFrameMailbox<Int>.Stats(posted: 3, taken: 1, replaced: 2))
+    }
+
+    func testPostAfterDrainRequestsNewWorker() {
+        let mailbox = CVFrameMailbox<Int>()
+
+        XCTAssertTrue(mailbox.post(1))
+        XCTAssertEqual(mailbox.take(), 1)
+        // Worker still draining: a new frame does not need another wake-up
+        XCTAssertFalse(mailbox.post(2))
+        XCTAssertEqual(mailbox.take(), 2)
+        XCTAssertNil(mailbox.take())
+        // Drain finished
+        XCTAssertTrue(mailbox.post(3))
+    }
+}
@@ -0,0 +1,61 @@
+//
+//  CVLensDistortionModelTests.swift
+//  BemoTests
+//
+//  Unit tests for the sparse-grid lens distortion model
+//
+
+import XCTest
+@testable import Bemo
+
+final class CVLensDistortionModelTests: XCTestCase {
+
+    /// Wide-angle style barrel distortion with a little tangential skew, 1080×1920 portrait buffer
+    private let calibration = CVLensDistortionModel.Calibration(
+        width: 1080, height: 1920,
+        fx: 900, fy: 900, cx: 560, cy: 950,
+        k1: -0.12, k2: 0.03, k3: 0, p1: 0.001, p2: -0.002
+    )
+
+    private let probes = [
+        CGPoint(x: 0.5, y: 0.5), CGPoint(x: 0.1, y: 0.1), CGPoint(x: 0.9, y: 0.15),
+        CGPoint(x: 0.2, y: 0.85), CGPoint(x: 0.75, y: 0.6)
+    ]
+
+    // MARK: - Correction Tests
+
+    func testDistortThenUndistortRoundTrips() {
+        let model = CVLensDistortionModel(calibration: calibration)
+        for ideal in probes {
+            let seen = model.distort(ideal)
+            // Border points really move under this lens; the grid must bring them back within ~half a pixel
+            let back = model.undistort(seen)
+            XCTAssertEqual(back.x, ideal.x, accuracy: 3e-4)
+            XCTAssertEqual(back.y, ideal.y, accuracy: 3e-4)
+        }
+        let corner = model.distort(CGPoint(x: 0.1, y: 0.1))
+        XCTAssertGreaterThan(hypot(corner.x - 0.1, corner.y - 0.1), 0.005)
+    }
+
+    func testMirroredCalibrationMatchesMirroredBuffer() {
+        let model = CVLensDistortionModel(calibration: calibration)
+        let mirrored = CVLensDistortionModel(calibration: calibration.mirrored())
+        for point in probes {
+            let flipped = CGPoint(x: 1 - point.x, y: point.y)
+            let expected = model.undistort(point)
+            let corrected = mirrored.undistort(flipped)
+            XCTAssertEqual(corrected.x, 1 - expected.x, accuracy: 1e-4)
+            XCTAssertEqual(corrected.y, expected.y, accuracy: 1e-4)
+        }
+    }
+
+    // MARK: - Decoding Tests
+
+    func testMissingDistortionTermsDecodeAsZero() throws {
+        let json = Data(#"{"width": 1080, "height": 1920, "fx": 900, "fy": 900, "cx": 540, "cy": 960, "k1": -0.1}"#.utf8)
+        let decoded = try JSONDecoder().decode(CVLensDistortionModel.Calibration.self, from: json)
+        XCTAssertEqual(decoded.k1, -0.1)
+        XCTAssertEqual(decoded.k2, 0)
+        XCTAssertEqual(decoded.p2, 0)
+    }
+}
@@ -0,0 +1,70 @@
+//
+//  CVLiftedPieceClassifierTests.swift
+//  BemoTests
+//
+//  Unit tests for on-plane vs lifted piece classification
+//
+
+import XCTest
+import CoreVideo
+@testable import Bemo
+
+final class CVLiftedPieceClassifierTests: XCTestCase {
+
+    /// 128×128 BGRA buffer, dark with a 52-pixel square of the given brightness in the middle
+    private func makeSquareBuffer(brightness: UInt8 = 200) throws -> CVPixelBuffer {
+        try CVPixelBufferFixture.gray(width: 128, height: 128) { x, y in
+            (38..<90).contains(x) && (38..<90).contains(y) ? brightness : 20
+        }
+    }
+
+    /// Square outline around the buffer center with the given half-size in pixels
+    private func outline(halfSize: CGFloat) -> [CGPoint] {
+        [(-1, -1), (1, -1), (1, 1), (-1, 1)].map { sx, sy in
+            CGPoint(x: (64 + CGFloat(sx) * halfSize) / 128, y: (64 + CGFloat(sy) * halfSize) / 128)
+        }
+    }
+
+    // MARK: - Classification Tests
+
+    func testPieceOnItsOutlineStaysOnPlane() throws {
+        let buffer = try makeSquareBuffer()
+        let classifier = CVLiftedPieceClassifier()
+        for _ in 0..<5 {
+            let observation = CVLiftedPieceClassifier.Observation(classId: 1, outline: outline(halfSize: 26), quality: 0.9)
+            XCTAssertTrue(classifier.classify([observation], in: buffer).isEmpty)
+        }
+    }
+
+    func testLargerThanProjectedAndMovingPieceIsLiftedAfterTwoFrames() throws {
+        let buffer = try makeSquareBuffer()
+        let classifier = CVLiftedPieceClassifier()
+        // The homography projects the model 1.3× smaller than the piece appears
+        let observation = CVLiftedPieceClassifier.Observation(classId: 1, outline: outline(halfSize: 20), quality: 0.1)
+        XCTAssertTrue(classifier.classify([observation], in: buffer).isEmpty)
+        XCTAssertEqual(classifier.classify([observation], in: buffer), [1])
+
+        // Back on its outline: it takes three on-plane frames to leave the lifted state
+        let placed = CVLiftedPieceClassifier.Observation(classId: 1, outline: outline(halfSize: 26), quality: 0.9)
+        XCTAssertEqual(classifier.classify([placed], in: buffer), [1])
+        XCTAssertEqual(classifier.classify([placed], in: buffer), [1])
+        XCTAssertTrue(classifier.classify([placed], in: buffer).isEmpty)
+    }
+
+    func testBlurredMovingPieceAtModelScaleStaysOnPlane() throws {
+        let classifier = CVLiftedPieceClassifier()
+        let sharp = try makeSquareBuffer()
+        let onOutline = outline(halfSize: 26)
+        for _ in 0..<3 {
+            let still = CVLiftedPieceClassifier.Observation(classId: 1, outline: onOutline, quality: 0.9)
+            XCTAssertTrue(classifier.classify([still], in: sharp).isEmpty)
+        }
+
+        // Slid across the board: motion-blurred edges and a poor track, but the same apparent size
+        let blurred = try makeSquareBuffer(brightness: 60)
+        let sliding = CVLiftedPieceClassifier.Observation(classId: 1, outline: onOutline, quality: 0.1)
+        for _ in 0..<5 {
+            XCTAssertTrue(classifier.classify([sliding], in: blurred).isEmpty)
+        }
+    }
+}
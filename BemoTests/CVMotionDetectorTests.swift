@@ -0,0 +1,77 @@
+//
+//  CVMotionDetectorTests.swift
+//  BemoTests
+//
+//  Unit tests for per-tile luma change detection
+//
+
+import XCTest
+import CoreVideo
+@testable import Bemo
+
+final class CVMotionDetectorTests: XCTestCase {
+
+    private let size = 64
+    private let columns = 4
+
+    /// 64×64 BGRA buffer (4×4 tiles of 16 px) with a uniform luma per tile
+    private func makeBuffer(_ luma: (_ tile: Int) -> UInt8) throws -> CVPixelBuffer {
+        let tileSize = size / columns
+        return try CVPixelBufferFixture.gray(width: size, height: size) { x, y in
+            luma((y / tileSize) * columns + x / tileSize)
+        }
+    }
+
+    // MARK: - Detection Tests
+
+    func testStillFramesAreStaticAndChangedTileIsFlagged() throws {
+        let detector = CVMotionDetector(columns: columns, threshold: 6)
+        let board = try makeBuffer { _ in 100 }
+
+        // Nothing to compare against yet: everything counts as changed
+        XCTAssertEqual(detector.update(with: board).changedCount, columns * columns)
+        XCTAssertTrue(detector.update(with: board).isStatic)
+
+        let moved = try makeBuffer { $0 == 5 ? 180 : 100 }
+        let motion = detector.update(with: moved)
+        XCTAssertEqual(motion.changedTiles, (0..<16).map { $0 == 5 })
+        XCTAssertEqual(motion.tileMeans[5], 180)
+        XCTAssertEqual(motion.changedBounds, CGRect(x: 0.25, y: 0.25, width: 0.25, height: 0.25))
+    }
+
+    func testChangeMustExceedThreshold() throws {
+        let detector = CVMotionDetector(columns: columns, threshold: 6)
+        _ = detector.update(with: try makeBuffer { _ in 100 })
+
+        // Exactly the threshold is sensor noise; one level more is motion
+        XCTAssertTrue(detector.update(with: try makeBuffer { $0 == 0 ? 106 : 100 }).isStatic)
+        XCTAssertEqual(detector.update(with: try makeBuffer { $0 == 0 ? 113 : 100 }).changedCount, 1)
+    }
+
+    func testSlowDriftAccumulatesAgainstAnchorUntilReanchored() throws {
+        let detector = CVMotionDetector(columns: columns, threshold: 6)
+        XCTAssertFalse(detector.update(with: try makeBuffer { _ in 100 }).isUnchangedSinceAnchor)
+        detector.anchorToLastFrame()
+
+        // A slow slide stays under the threshold frame to frame but latches once it exceeds it overall
+        var motion = detector.update(with: try makeBuffer { $0 == 10 ? 104 : 100 })
+        XCTAssertTrue(motion.isStatic)
+        XCTAssertTrue(motion.isUnchangedSinceAnchor)
+        for level in stride(from: 108, through: 124, by: 4) {
+            motion = detector.update(with: try makeBuffer { $0 == 10 ? UInt8(level) : 100 })
+            XCTAssertTrue(motion.isStatic)
+        }
+        XCTAssertEqual(motion.changedSinceAnchor, (0..<16).map { $0 == 10 })
+
+        // Still flagged on the next still frame, cleared only by a new anchor
+        let settled = try makeBuffer { $0 == 10 ? 124 : 100 }
+        XCTAssertFalse(detector.update(with: settled).isUnchangedSinceAnchor)
+        detector.anchorToLastFrame()
+        XCTAssertTrue(detector.update(with: settled).isUnchangedSinceAnchor)
+
+        // Reset forgets both references, like the first frame
+        detector.reset()
+        XCTAssertEqual(detector.update(with: settled).changedCount, columns * columns)
+        XCTAssertFalse(detector.update(with: settled).isUnchangedSinceAnchor)
+    }
+}
@@ -0,0 +1,75 @@
+//
+//  CVPieceIdentityTrackerTests.swift
+//  BemoTests
+//
+//  Unit tests for stable identity of same-shape tangram pieces
+//
+
+import XCTest
+import CoreGraphics
+@testable import Bemo
+
+final class CVPieceIdentityTrackerTests: XCTestCase {
+
+    // Two large triangles authored in different orientations, as in tangram_shapes_2d.json
+    private let models: [Int: CVPieceIdentityTracker.Model] = [
+        2: .init(vertices: [CGPoint(x: -98, y: -102), CGPoint(x: 12, y: -102), CGPoint(x: -43, y: -47)],
+                 color: SIMD3(0, 2, 204)),
+        3: .init(vertices: [CGPoint(x: -100, y: -100), CGPoint(x: -45, y: -45), CGPoint(x: -100, y: 10)],
+                 color: SIMD3(255, 0, 3))
+    ]
+
+    private func posed(_ classId: Int, x: Double, y: Double, theta: Double) -> [CGPoint] {
+        let c = cos(theta), s = sin(theta)
+        return models[classId]!.vertices.map {
+            CGPoint(x: x + Double($0.x) * c - Double($0.y) * s, y: y + Double($0.x) * s + Double($0.y) * c)
+        }
+    }
+
+    // MARK: - Identity Tests
+
+    func testDetectorSwapKeepsTrackedIdentity() {
+        let tracker = CVPieceIdentityTracker(models: models)
+        let left = posed(2, x: 0, y: 0, theta: 0)
+        let right = posed(3, x: 300, y: 0, theta: 0.4)
+
+        let first = tracker.resolve([
+            .init(classId: 2, polygon: left, color: nil),
+            .init(classId: 3, polygon: right, color: nil)
+        ], at: 0)
+        XCTAssertEqual(first, [2: 2, 3: 3])
+
+        // Same pieces, barely moved, with the detector's labels flipped
+        let nudged = left.map { CGPoint(x: $0.x + 2, y: $0.y) }
+        let second = tracker.resolve([
+            .init(classId: 3, polygon: nudged, color: nil),
+            .init(classId: 2, polygon: right, color: nil)
+        ], at: 0.033)
+        XCTAssertEqual(second, [3: 2, 2: 3])
+    }
+
+    func testColorBreaksTieWithoutHistory() {
+        let tracker = CVPieceIdentityTracker(models: models)
+        // Detector calls the red piece class 2 (blue); no tracks yet, so color decides
+        let remap = tracker.resolve([
+            .init(classId: 2, polygon: posed(2, x: 0, y: 0, theta: 0), color: SIMD3(230, 20, 25))
+        ], at: 0)
+
+        XCTAssertEqual(remap, [2: 3])
+    }
+
+    // MARK: - Re-posing Tests
+
+    func testFittedPoseReproducesPolygonUnderOtherModel() throws {
+        let tracker = CVPieceIdentityTracker(models: models)
+        let polygon = posed(2, x: 40, y: -15, theta: 1.1)
+
+        let pose = try XCTUnwrap(tracker.pose(of: 3, fittedTo: polygon))
+        let refit = posed(3, x: pose.x, y: pose.y, theta: pose.theta)
+
+        for vertex in refit {
+            let nearest = polygon.map { hypot($0.x - vertex.x, $0.y - vertex.y) }.min() ?? .infinity
+            XCTAssertEqual(Double(nearest), 0, accuracy: 0.5)
+        }
+    }
+}
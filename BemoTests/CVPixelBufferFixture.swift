@@ -0,0 +1,46 @@
+//
+//  CVPixelBufferFixture.swift
+//  BemoTests
+//
+//  Synthetic camera frames shared by the CV service tests
+//
+
+import XCTest
+import CoreVideo
+
+enum CVPixelBufferFixture {
+
+    /// Opaque BGRA buffer with each pixel's color given by `color(x, y)`
+    static func bgra(
+        width: Int,
+        height: Int,
+        color: (_ x: Int, _ y: Int) -> (r: UInt8, g: UInt8, b: UInt8)
+    ) throws -> CVPixelBuffer {
+        var buffer: CVPixelBuffer?
+        CVPixelBufferCreate(kCFAllocatorDefault, width, height, kCVPixelFormatType_32BGRA, nil, &buffer)
+        let pixelBuffer = try XCTUnwrap(buffer)
+        CVPixelBufferLockBaseAddress(pixelBuffer, [])
+        defer { CVPixelBufferUnlockBaseAddress(pixelBuffer, []) }
+        let base = try XCTUnwrap(CVPixelBufferGetBaseAddress(pixelBuffer)).assumingMemoryBound(to: UInt8.self)
+        let rowBytes = CVPixelBufferGetBytesPerRow(pixelBuffer)
+        for y in 0..<height {
+            for x in 0..<width {
+                let pixel = base + y * rowBytes + x * 4
+                let (r, g, b) = color(x, y)
+                pixel[0] = b
+                pixel[1] = g
+                pixel[2] = r
+                pixel[3] = 255
+            }
+        }
+        return pixelBuffer
+    }
+
+    /// Gray BGRA buffer with each pixel's luma given by `luma(x, y)`
+    static func gray(width: Int, height: Int, luma: (_ x: Int, _ y: Int) -> UInt8) throws -> CVPixelBuffer {
+        try bgra(width: width, height: height) { x, y in
+            let value = luma(x, y)
+            return (value, value, value)
+        }
+    }
+}
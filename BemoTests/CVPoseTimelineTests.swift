@@ -0,0 +1,117 @@
+//
+//  CVPoseTimelineTests.swift
+//  BemoTests
+//
+//  Unit tests for display-time queries and pose uncertainty of the CV pose timeline
+//
+
+import XCTest
+@testable import Bemo
+
+final class CVPoseTimelineTests: XCTestCase {
+
+    private let square = [CGPoint(x: 90, y: 90), CGPoint(x: 110, y: 90), CGPoint(x: 110, y: 110), CGPoint(x: 90, y: 110)]
+
+    private func record(_ timeline: CVPoseTimeline, x: Double, at time: CFTimeInterval) {
+        let polygon = square.map { CGPoint(x: $0.x + x - 100, y: $0.y) }
+        timeline.record(
+            poses: [1: CVPoseTimeline.Pose(x: x, y: 100, theta: 0)],
+            polygons: [1: polygon],
+            captureTime: time,
+            publishedAt: time + 0.05
+        )
+    }
+
+    // MARK: - Query Tests
+
+    func testInterpolatesBetweenFilteredStates() throws {
+        let timeline = CVPoseTimeline()
+        record(timeline, x: 100, at: 0)
+        record(timeline, x: 101, at: 0.1)
+
+        // Second state is filtered: 100 + 0.7 × 1
+        let midway = try XCTUnwrap(timeline.posesAt(0.05)[1])
+        XCTAssertEqual(midway.x, 100.35, accuracy: 1e-9)
+        XCTAssertEqual(midway.y, 100, accuracy: 1e-9)
+
+        let polygon = try XCTUnwrap(timeline.polygonsAt(0.05)[1])
+        let centerX = polygon.reduce(0) { $0 + Double($1.x) } / Double(polygon.count)
+        XCTAssertEqual(centerX, 100.35, accuracy: 1e-9)
+    }
+
+    func testExtrapolationIsBoundedByLatency() throws {
+        let timeline = CVPoseTimeline()
+        record(timeline, x: 100, at: 0)
+        record(timeline, x: 101, at: 0.1)
+
+        // Filtered velocity 0.2 × 1 / 0.1 = 2 per second; horizon is latency 0.05 + one 30 fps frame
+        let shortly = try XCTUnwrap(timeline.posesAt(0.15)[1])
+        XCTAssertEqual(shortly.x, 100.7 + 2 * 0.05, accuracy: 1e-9)
+        let muchLater = try XCTUnwrap(timeline.posesAt(1.1)[1])
+        XCTAssertEqual(muchLater.x, 100.7 + 2 * (0.05 + 1.0 / 30.0), accuracy: 1e-9)
+    }
+
+    func testUnseenTracksDropUnlessConfirmed() {
+        let timeline = CVPoseTimeline()
+        record(timeline, x: 100, at: 0)
+        record(timeline, x: 100, at: 0.1)
+
+        // Another piece 0.6 s later: piece 1 has gone stale
+        let other = CVPoseTimeline.Pose(x: 50, y: 50, theta: 0)
+        timeline.record(poses: [2: other], polygons: [:], captureTime: 0.7, publishedAt: 0.75)
+        XCTAssertNil(timeline.posesAt(0.7)[1])
+        XCTAssertNotNil(timeline.posesAt(0.7)[2])
+
+        // A color confirmation keeps a track alive without a pose measurement
+        let confirmed = CVPoseTimeline()
+        record(confirmed, x: 100, at: 0)
+        record(confirmed, x: 100, at: 0.1)
+        confirmed.confirm([1], at: 0.5)
+        confirmed.record(poses: [2: other], polygons: [:], captureTime: 0.7, publishedAt: 0.75)
+        XCTAssertNotNil(confirmed.posesAt(0.7)[1])
+    }
+
+    // MARK: - Uncertainty Tests
+
+    func testStillPieceSettlesAndMovingPieceDoesNot() throws {
+        let still = CVPoseTimeline()
+        for (frame, jitter) in [0, 0.3, -0.2, 0.1, -0.3, 0.2].enumerated() {
+            record(still, x: 100 + jitter, at: Double(frame) / 30)
+        }
+        let settled = try XCTUnwrap(still.uncertainties()[1])
+        XCTAssertTrue(settled.isWithin(position: 2, rotation: 0.05))
+        XCTAssertGreaterThan(settled.quality, 0.5)
+
+        let moving = CVPoseTimeline()
+        for (frame, x) in [100.0, 104, 100, 108, 99, 106].enumerated() {
+            record(moving, x: x, at: Double(frame) / 30)
+        }
+        let unsettled = try XCTUnwrap(moving.uncertainties()[1])
+        XCTAssertFalse(unsettled.isWithin(position: 2, rotation: 0.05))
+        XCTAssertLessThan(unsettled.quality, settled.quality)
+    }
+
+    func testSettledPoseAtToleranceEdgeIsNotWithin() throws {
+        let timeline = CVPoseTimeline()
+        for (frame, jitter) in [0, 0.3, -0.2, 0.1, -0.3, 0.2].enumerated() {
+            record(timeline, x: 100 + jitter, at: Double(frame) / 30)
+        }
+        let uncertainty = try XCTUnwrap(timeline.uncertainties()[1])
+        let radius = uncertainty.positionRadius()
+        XCTAssertGreaterThan(radius, 0)
+        XCTAssertLessThan(radius, 1)
+
+        // A small ellipse is not enough when the pose itself sits at the edge of the tolerance
+        XCTAssertTrue(uncertainty.isWithin(position: 2, rotation: 0.05, positionError: 2 - radius * 1.5))
+        XCTAssertFalse(uncertainty.isWithin(position: 2, rotation: 0.05, positionError: 2 - radius * 0.5))
+        XCTAssertTrue(uncertainty.isBeyond(position: 2, positionError: 2 + radius * 1.5))
+        XCTAssertFalse(uncertainty.isBeyond(position: 2, positionError: 2 + radius * 0.5))
+    }
+
+    func testNoUncertaintyBeforeEnoughSamples() {
+        let timeline = CVPoseTimeline()
+        record(timeline, x: 100, at: 0)
+        record(timeline, x: 100, at: 1.0 / 30)
+        XCTAssertNil(timeline.uncertainties()[1])
+    }
+}
@@ -0,0 +1,45 @@
+//
+//  CVPowerSchedulerTests.swift
+//  BemoTests
+//
+//  Unit tests for CV power state transitions
+//
+
+import XCTest
+@testable import Bemo
+
+final class CVPowerSchedulerTests: XCTestCase {
+
+    // MARK: - Transition Tests
+
+    func testStillnessStepsDownAndMotionWakesToFull() {
+        var scheduler = CVPowerScheduler()
+        scheduler.idleAfter = 5
+        XCTAssertNil(scheduler.update(relevantMotion: true, at: 0))
+        XCTAssertNil(scheduler.update(relevantMotion: false, at: 0.1))
+
+        XCTAssertEqual(scheduler.update(relevantMotion: false, at: 0.4)?.to, .track)
+        XCTAssertTrue(scheduler.policy.reusesStillResults)
+        XCTAssertEqual(scheduler.update(relevantMotion: false, at: 5.1)?.to, .watch)
+        XCTAssertFalse(scheduler.policy.runsPipeline)
+
+        let wake = scheduler.update(relevantMotion: true, at: 6)
+        XCTAssertEqual(wake, CVPowerScheduler.Transition(from: .watch, to: .full, reason: .motion, time: 6))
+        XCTAssertEqual(scheduler.stats.transitions, 3)
+        XCTAssertEqual(scheduler.stats.wakeUps, 1)
+        XCTAssertEqual(scheduler.stats.timeInState[.watch] ?? 0, 0.9, accuracy: 1e-9)
+    }
+
+    func testCeilingCapsWakeUps() {
+        var scheduler = CVPowerScheduler()
+        XCTAssertEqual(scheduler.request(.watch, at: 0)?.to, .watch)
+        // Menus: motion keeps watching
+        XCTAssertNil(scheduler.update(relevantMotion: true, at: 1))
+        XCTAssertEqual(scheduler.state, .watch)
+
+        // Starting a puzzle wakes at once
+        XCTAssertEqual(scheduler.request(.full, at: 2)?.to, .full)
+        XCTAssertEqual(scheduler.request(.off, at: 3)?.to, .off)
+        XCTAssertNil(scheduler.update(relevantMotion: true, at: 4))
+    }
+}
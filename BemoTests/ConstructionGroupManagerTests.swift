@@ -0,0 +1,62 @@
+//
+//  ConstructionGroupManagerTests.swift
+//  BemoTests
+//
+//  Unit tests for grid broadphase contact and union-find grouping of placed pieces
+//
+
+import XCTest
+import SpriteKit
+@testable import Bemo
+
+final class ConstructionGroupManagerTests: XCTestCase {
+
+    // MARK: - Test Data
+
+    /// 50 pt square with a corner at `x`; flipped squares extend to the left of it
+    private func square(_ name: String, x: CGFloat, y: CGFloat = 0, isFlipped: Bool = false) -> PuzzlePieceNode {
+        let node = PuzzlePieceNode(pieceType: .square)
+        node.name = name
+        node.position = CGPoint(x: x, y: y)
+        node.isFlipped = isFlipped
+        return node
+    }
+
+    private func groupedPieces(_ pieces: [PuzzlePieceNode]) -> [Set<String>] {
+        ConstructionGroupManager().updateGroups(with: pieces).map(\.pieces)
+    }
+
+    // MARK: - Broadphase Tests
+
+    func testPiecesAtContactToleranceWithTouchingBoundsAreGrouped() {
+        // Polygons 16 pt apart (the contact tolerance): padded bounds meet exactly at x = 58
+        let pieces = [square("a", x: 0), square("b", x: 116, isFlipped: true)]
+        XCTAssertEqual(groupedPieces(pieces), [["a", "b"]])
+    }
+
+    func testContactAcrossGridCellBoundaryIsFound() {
+        // 160 pt cells: the first square spans cells 0 and 1, the second lies in cell 1 only
+        let pieces = [square("a", x: 150), square("b", x: 216)]
+        XCTAssertEqual(groupedPieces(pieces), [["a", "b"]])
+    }
+
+    func testDistantPiecesStayUngrouped() {
+        let pieces = [square("a", x: 0), square("b", x: 67), square("c", x: 1000, y: 1000)]
+        XCTAssertTrue(groupedPieces(pieces).isEmpty)
+    }
+
+    // MARK: - Union-Find Tests
+
+    func testChainOfContactsFormsOneGroup() {
+        // a–b and b–c touch; a and c are far apart but join through b
+        let pieces = [square("a", x: 0), square("b", x: 66), square("c", x: 132), square("lone", x: 600)]
+        XCTAssertEqual(groupedPieces(pieces), [["a", "b", "c"]])
+    }
+
+    func testSeparateClustersFormSeparateGroups() {
+        let pieces = [square("a", x: 0), square("b", x: 66), square("c", x: 600), square("d", x: 666)]
+        let groups = groupedPieces(pieces)
+        XCTAssertEqual(groups.count, 2)
+        XCTAssertEqual(Set(groups), [["a", "b"], ["c", "d"]])
+    }
+}
@@ -0,0 +1,93 @@
+//
+//  TangramAssemblyPlannerTests.swift
+//  BemoTests
+//
+//  Unit tests for the connected build-order planner and target layout audit
+//
+
+import XCTest
+import CoreGraphics
+@testable import Bemo
+
+final class TangramAssemblyPlannerTests: XCTestCase {
+
+    // MARK: - Test Data
+
+    private func makePuzzle(_ targets: [GamePuzzleData.TargetPiece]) -> GamePuzzleData {
+        GamePuzzleData(id: "planner-test", name: "Planner Test", category: "test", difficulty: 1, targetPieces: targets)
+    }
+
+    /// Square at the origin with a small triangle on its x = 50 edge and a medium triangle far away
+    private var splitPuzzle: GamePuzzleData {
+        makePuzzle([
+            .init(id: "square", pieceType: .square, transform: .identity),
+            .init(id: "small", pieceType: .smallTriangle1, transform: CGAffineTransform(translationX: 50, y: 0)),
+            .init(id: "far", pieceType: .mediumTriangle, transform: CGAffineTransform(translationX: 600, y: 600))
+        ])
+    }
+
+    private func planner(for graph: TangramPuzzleGraph) -> TangramAssemblyPlanner {
+        TangramAssemblyPlanner(graph: graph, adjacency: graph.adjacency(for: nil)) { _ in 1 }
+    }
+
+    // MARK: - Planning Tests
+
+    func testNextStepStaysConnectedToCluster() {
+        let graph = TangramPuzzleGraph(puzzle: splitPuzzle)
+        let square = graph.mask(for: ["square"])
+
+        let next = planner(for: graph).nextStep(cluster: square, validated: square)
+
+        XCTAssertEqual(next, graph.index(of: "small"))
+    }
+
+    func testPlanReportsUnreachableTargets() {
+        let graph = TangramPuzzleGraph(puzzle: splitPuzzle)
+        let square = graph.mask(for: ["square"])
+
+        let plan = planner(for: graph).plan(cluster: square, validated: square)
+
+        XCTAssertEqual(plan.order, [graph.index(of: "small")!])
+        XCTAssertFalse(plan.isComplete)
+        XCTAssertGreaterThanOrEqual(plan.cost, TangramAssemblyPlanner.unreachablePenalty)
+    }
+
+    func testPlanCompletesConnectedPuzzle() {
+        let graph = TangramPuzzleGraph(puzzle: makePuzzle(Array(splitPuzzle.targetPieces.prefix(2))))
+        let square = graph.mask(for: ["square"])
+
+        let plan = planner(for: graph).plan(cluster: square, validated: square)
+
+        XCTAssertTrue(plan.isComplete)
+        XCTAssertEqual(plan.order.count, 1)
+    }
+
+    // MARK: - Target Layout Audit Tests
+
+    func testAuditFlagsDisconnectedSilhouette() {
+        let issues = TangramAssemblyPlanner.auditTargetLayout(TangramPuzzleGraph(puzzle: splitPuzzle))
+
+        XCTAssertEqual(issues, [.disconnected(components: 2)])
+    }
+
+    func testAuditFlagsOverlapAndDuplicates() {
+        let puzzle = makePuzzle([
+            .init(id: "a", pieceType: .square, transform: .identity),
+            .init(id: "b", pieceType: .square, transform: CGAffineTransform(translationX: 10, y: 10))
+        ])
+
+        let issues = TangramAssemblyPlanner.auditTargetLayout(TangramPuzzleGraph(puzzle: puzzle))
+
+        XCTAssertTrue(issues.contains(.duplicatePiece(.square)))
+        XCTAssertTrue(issues.contains(.overlap("a", "b")))
+    }
+
+    func testTouchingTargetsAreNotOverlapAndLibraryAuditKeysByPuzzle() {
+        let clean = makePuzzle(Array(splitPuzzle.targetPieces.prefix(2)))
+        XCTAssertEqual(TangramAssemblyPlanner.auditTargetLayout(TangramPuzzleGraph(puzzle: clean)), [])
+
+        let split = GamePuzzleData(id: "split", name: "Split", category: "test", difficulty: 1, targetPieces: splitPuzzle.targetPieces)
+        let report = TangramAssemblyPlanner.auditTargetLayouts([clean, split])
+        XCTAssertEqual(report, ["split": [.disconnected(components: 2)]])
+    }
+}
@@ -0,0 +1,86 @@
+//
+//  TangramMotionSolverTests.swift
+//  BemoTests
+//
+//  Unit tests for analytic slide and rotation limits of constrained editor motion
+//
+
+import XCTest
+import CoreGraphics
+@testable import Bemo
+
+final class TangramMotionSolverTests: XCTestCase {
+
+    // MARK: - Test Data
+
+    private let squareOffsets = [CGPoint(x: 0, y: 0), CGPoint(x: 50, y: 0), CGPoint(x: 50, y: 50), CGPoint(x: 0, y: 50)]
+
+    private func square(_ id: String, at origin: CGPoint, angle: CGFloat = 0) -> TangramOverlapDetector.Shape {
+        let c = cos(angle), s = sin(angle)
+        return TangramOverlapDetector.Shape(pieceId: id, vertices: squareOffsets.map {
+            CGPoint(x: origin.x + $0.x * c - $0.y * s, y: origin.y + $0.x * s + $0.y * c)
+        })
+    }
+
+    // MARK: - Slide Tests
+
+    func testNeighborsBlockSlideAtContactDistance() {
+        let moving = square("moving", at: .zero)
+        // 30 pt gap ahead and 20 pt gap behind; tolerance lets the slide sink 1 pt into each
+        let obstacles = [square("ahead", at: CGPoint(x: 80, y: 0)), square("behind", at: CGPoint(x: -70, y: 0))]
+
+        let range = TangramMotionSolver.slideLimits(
+            moving: moving,
+            direction: CGVector(dx: 1, dy: 0),
+            baseRange: -100...200,
+            obstacles: obstacles
+        )
+        XCTAssertEqual(range.upperBound, 31, accuracy: 1e-9)
+        XCTAssertEqual(range.lowerBound, -21, accuracy: 1e-9)
+    }
+
+    func testSlideAlongClearPathKeepsBaseRange() {
+        let moving = square("moving", at: .zero)
+        let obstacles = [square("beside", at: CGPoint(x: 80, y: 0))]
+
+        let range = TangramMotionSolver.slideLimits(
+            moving: moving,
+            direction: CGVector(dx: 0, dy: 1),
+            baseRange: -100...200,
+            obstacles: obstacles
+        )
+        XCTAssertEqual(range, -100...200)
+    }
+
+    // MARK: - Rotation Tests
+
+    func testContactLimitsRotationAtWedgeAngle() throws {
+        // Both squares hinge on the pivot corner: the moving one spans 0°–90°, the obstacle 135°–225°,
+        // so a turn closes the 45° gap counterclockwise or the 135° gap clockwise
+        let pivot = CGPoint(x: 100, y: 100)
+        let obstacle = square("obstacle", at: pivot, angle: 3 * .pi / 4)
+
+        let limits = try XCTUnwrap(TangramMotionSolver.rotationLimits(
+            pieceId: "moving",
+            localOffsets: squareOffsets,
+            pivot: pivot,
+            currentAngle: 0,
+            obstacles: [obstacle],
+            tolerance: 0.001
+        ))
+        XCTAssertEqual(limits.max, .pi / 4, accuracy: 1e-3)
+        XCTAssertEqual(limits.min, -3 * .pi / 4, accuracy: 1e-3)
+    }
+
+    func testRotationWithoutReachableObstacleIsFree() {
+        let limits = TangramMotionSolver.rotationLimits(
+            pieceId: "moving",
+            localOffsets: squareOffsets,
+            pivot: CGPoint(x: 100, y: 100),
+            currentAngle: 0,
+            obstacles: [square("far", at: CGPoint(x: 500, y: 0))],
+            tolerance: 0.001
+        )
+        XCTAssertNil(limits)
+    }
+}
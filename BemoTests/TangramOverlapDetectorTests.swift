@@ -0,0 +1,81 @@
+//
+//  TangramOverlapDetectorTests.swift
+//  BemoTests
+//
+//  Unit tests for SAT overlap and connection contact between editor pieces
+//
+
+import XCTest
+import CoreGraphics
+@testable import Bemo
+
+final class TangramOverlapDetectorTests: XCTestCase {
+
+    // MARK: - Test Data
+
+    private func square(_ id: String, x: CGFloat, y: CGFloat = 0, side: CGFloat = 50) -> TangramOverlapDetector.Shape {
+        TangramOverlapDetector.Shape(pieceId: id, vertices: [
+            CGPoint(x: x, y: y), CGPoint(x: x + side, y: y),
+            CGPoint(x: x + side, y: y + side), CGPoint(x: x, y: y + side)
+        ])
+    }
+
+    // MARK: - Overlap Tests
+
+    func testTouchingPiecesDoNotOverlap() {
+        let a = square("a", x: 0)
+        XCTAssertFalse(TangramOverlapDetector.hasAreaOverlap(a, square("b", x: 50)))
+        // Penetration within tolerance still counts as touching
+        XCTAssertFalse(TangramOverlapDetector.hasAreaOverlap(a, square("b", x: 49.5)))
+        // Corner to corner only
+        XCTAssertFalse(TangramOverlapDetector.hasAreaOverlap(a, square("b", x: 50, y: 50)))
+    }
+
+    func testOverlappingPiecesOverlap() {
+        let a = square("a", x: 0)
+        XCTAssertTrue(TangramOverlapDetector.hasAreaOverlap(a, square("b", x: 40)))
+        XCTAssertTrue(TangramOverlapDetector.hasAreaOverlap(a, square("b", x: 10, y: 10, side: 20)))
+
+        // Rotated pieces are tested on their own edge normals as well
+        let diamond = TangramOverlapDetector.Shape(pieceId: "d", vertices: [
+            CGPoint(x: 75, y: 25), CGPoint(x: 45, y: 55), CGPoint(x: 15, y: 25), CGPoint(x: 45, y: -5)
+        ])
+        XCTAssertTrue(TangramOverlapDetector.hasAreaOverlap(a, diamond))
+    }
+
+    func testFirstOverlapSkipsItselfAndExcludedPieces() {
+        let moving = square("moving", x: 0)
+        let others = [moving, square("connected", x: 30), square("touching", x: -50), square("blocking", x: 0, y: 30)]
+
+        XCTAssertEqual(TangramOverlapDetector.firstOverlap(of: moving, in: others)?.pieceId, "connected")
+        XCTAssertEqual(TangramOverlapDetector.firstOverlap(of: moving, in: others, excluding: ["connected"])?.pieceId, "blocking")
+        XCTAssertNil(TangramOverlapDetector.firstOverlap(of: moving, in: others, excluding: ["connected", "blocking"]))
+    }
+
+    // MARK: - Connection Tests
+
+    func testVertexConnectionsUseTheirOwnTolerance() {
+        XCTAssertTrue(TangramOverlapDetector.verticesMeet(.zero, CGPoint(x: 1, y: 1)))
+        XCTAssertFalse(TangramOverlapDetector.verticesMeet(.zero, CGPoint(x: 1, y: 1), tolerances: .satisfied))
+
+        let start = CGPoint(x: 0, y: 0), end = CGPoint(x: 100, y: 0)
+        XCTAssertTrue(TangramOverlapDetector.vertexOnEdge(CGPoint(x: 40, y: 1.5), edgeStart: start, edgeEnd: end))
+        XCTAssertTrue(TangramOverlapDetector.vertexOnEdge(CGPoint(x: 40, y: 0), edgeStart: start, edgeEnd: end, tolerances: .satisfied))
+        // Past the end of the segment, even though on its line
+        XCTAssertFalse(TangramOverlapDetector.vertexOnEdge(CGPoint(x: 105, y: 0), edgeStart: start, edgeEnd: end))
+    }
+
+    func testEdgeContactLengthNeedsParallelEdgesThatReachEachOther() {
+        let long = (start: CGPoint(x: 0, y: 0), end: CGPoint(x: 100, y: 0))
+
+        // Opposite direction, half on the long edge
+        let contact = TangramOverlapDetector.edgeContactLength(long, (CGPoint(x: 130, y: 1), CGPoint(x: 70, y: 1)))
+        XCTAssertEqual(try XCTUnwrap(contact), 30, accuracy: 1e-9)
+        XCTAssertNil(TangramOverlapDetector.edgeContactLength(long, (CGPoint(x: 130, y: 1), CGPoint(x: 70, y: 1)), tolerances: .satisfied))
+
+        // End to end is contact without shared length; a gap or a tilt is not
+        XCTAssertEqual(TangramOverlapDetector.edgeContactLength(long, (CGPoint(x: 100, y: 0), CGPoint(x: 150, y: 0))), 0)
+        XCTAssertNil(TangramOverlapDetector.edgeContactLength(long, (CGPoint(x: 105, y: 0), CGPoint(x: 150, y: 0))))
+        XCTAssertNil(TangramOverlapDetector.edgeContactLength(long, (CGPoint(x: 20, y: 0), CGPoint(x: 60, y: 20))))
+    }
+}
@@ -0,0 +1,108 @@
+//
+//  TangramPuzzleGraphTests.swift
+//  BemoTests
+//
+//  Unit tests for the compiled target adjacency graph used by hint selection
+//
+
+import XCTest
+import CoreGraphics
+@testable import Bemo
+
+final class TangramPuzzleGraphTests: XCTestCase {
+
+    // MARK: - Test Data
+
+    private var puzzle: GamePuzzleData!
+    private var graph: TangramPuzzleGraph!
+
+    override func setUp() {
+        super.setUp()
+        // Square occupies (0,0)-(50,50); small triangle shares the x = 50 edge; medium triangle sits far away
+        puzzle = GamePuzzleData(
+            id: "graph-test",
+            name: "Graph Test",
+            category: "test",
+            difficulty: 1,
+            targetPieces: [
+                .init(id: "square", pieceType: .square, transform: .identity),
+                .init(id: "small", pieceType: .smallTriangle1, transform: CGAffineTransform(translationX: 50, y: 0)),
+                .init(id: "far", pieceType: .mediumTriangle, transform: CGAffineTransform(translationX: 600, y: 600))
+            ]
+        )
+        graph = TangramPuzzleGraph(puzzle: puzzle)
+    }
+
+    override func tearDown() {
+        puzzle = nil
+        graph = nil
+        super.tearDown()
+    }
+
+    // MARK: - Compilation Tests
+
+    func testAdjacencyDetectsSharedEdgeOnly() {
+        let adj = graph.adjacency(for: nil)
+        let square = graph.mask(for: ["square"])
+        let small = graph.mask(for: ["small"])
+        let far = graph.mask(for: ["far"])
+
+        XCTAssertEqual(TangramPuzzleGraph.neighbors(of: square, adjacency: adj), small)
+        XCTAssertEqual(TangramPuzzleGraph.neighbors(of: small, adjacency: adj), square)
+        XCTAssertEqual(TangramPuzzleGraph.neighbors(of: far, adjacency: adj), 0)
+    }
+
+    func testSharedEdgeNeedsParallelOverlap() {
+        let square = [CGPoint(x: 0, y: 0), CGPoint(x: 50, y: 0), CGPoint(x: 50, y: 50), CGPoint(x: 0, y: 50)]
+        // Half of the square's right edge, 5 pt away
+        let beside = [CGPoint(x: 55, y: 25), CGPoint(x: 100, y: 25), CGPoint(x: 55, y: 50)]
+        XCTAssertEqual(TangramPuzzleGraph.sharedEdgeLength(square, beside, edgeTolerance: 14), 25, accuracy: 1e-9)
+
+        // Rotated 45° so only a corner meets the square's corner: perpendicular and oblique edges share nothing
+        let cornerOnly = [CGPoint(x: 50, y: 50), CGPoint(x: 85, y: 85), CGPoint(x: 15, y: 85)]
+        XCTAssertEqual(TangramPuzzleGraph.sharedEdgeLength(square, cornerOnly, edgeTolerance: 14), 0)
+
+        // Collinear edges meeting end to end
+        let endToEnd = [CGPoint(x: 50, y: 0), CGPoint(x: 100, y: 0), CGPoint(x: 100, y: -50)]
+        XCTAssertEqual(TangramPuzzleGraph.sharedEdgeLength(square, endToEnd, edgeTolerance: 14), 0)
+    }
+
+    func testSharedEdgeLengthIsStoredPerPair() {
+        let square = graph.index(of: "square")!
+        let small = graph.index(of: "small")!
+
+        XCTAssertEqual(graph.sharedEdgeLength(of: small, with: graph.allMask, difficulty: nil), 50, accuracy: 1e-6)
+        XCTAssertEqual(graph.sharedEdgeLength(of: square, with: graph.mask(for: ["far"]), difficulty: nil), 0)
+    }
+
+    func testMatchesTracksPuzzleIdentity() {
+        XCTAssertTrue(graph.matches(puzzle))
+
+        let moved = GamePuzzleData(
+            id: puzzle.id,
+            name: puzzle.name,
+            category: puzzle.category,
+            difficulty: puzzle.difficulty,
+            targetPieces: Array(puzzle.targetPieces.dropLast())
+        )
+        XCTAssertFalse(graph.matches(moved))
+    }
+
+    // MARK: - Bitset Operation Tests
+
+    func testLargestComponentPrefersConnectedTargets() {
+        let adj = graph.adjacency(for: .normal)
+        let all = graph.allMask
+        let component = TangramPuzzleGraph.largestComponent(within: all, adjacency: adj)
+
+        XCTAssertEqual(component, graph.mask(for: ["square", "small"]))
+    }
+
+    func testCentroidAveragesSpriteKitPositions() {
+        let centroid = graph.centroid(of: graph.mask(for: ["square", "small"]))
+
+        XCTAssertEqual(centroid.x, 25, accuracy: 0.001)
+        XCTAssertEqual(centroid.y, 0, accuracy: 0.001)
+        XCTAssertEqual(graph.centroid(of: 0), .zero)
+    }
+}
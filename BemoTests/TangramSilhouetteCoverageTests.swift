@@ -0,0 +1,96 @@
+//
+//  TangramSilhouetteCoverageTests.swift
+//  BemoTests
+//
+//  Unit tests for piece polygons agreeing with target silhouettes under rotation and flips
+//
+
+import XCTest
+import CoreGraphics
+@testable import Bemo
+
+final class TangramSilhouetteCoverageTests: XCTestCase {
+
+    // MARK: - Test Data
+
+    private let translation = CGPoint(x: 120, y: -40)
+    private let angles: [CGFloat] = [0.3, .pi / 4, 2.0]
+
+    /// Raw target transform rotating by `angle`, mirrored in x first when `mirrored`
+    private func transform(angle: CGFloat, mirrored: Bool) -> CGAffineTransform {
+        let rotation = CGAffineTransform(rotationAngle: angle)
+        let base = mirrored ? rotation.scaledBy(x: -1, y: 1) : rotation
+        return CGAffineTransform(a: base.a, b: base.b, c: base.c, d: base.d, tx: translation.x, ty: translation.y)
+    }
+
+    /// SK target space mirrors raw y, so a piece lying on a target at raw angle θ has zRotation π − θ
+    /// and the opposite handedness of the target transform
+    private func placedPolygon(on target: GamePuzzleData.TargetPiece, angle: CGFloat, mirrored: Bool) -> [CGPoint] {
+        let targetPolygon = TangramBounds.computeSKTransformedVertices(for: target)
+        return TangramSilhouetteCoverage.piecePolygon(
+            pieceType: target.pieceType,
+            position: TangramGameGeometry.centerOfVertices(targetPolygon),
+            rotation: .pi - angle,
+            isFlipped: !mirrored
+        )
+    }
+
+    private func assertSamePolygon(_ actual: [CGPoint], _ expected: [CGPoint], _ message: String, line: UInt = #line) {
+        XCTAssertEqual(actual.count, expected.count, message, line: line)
+        for (a, e) in zip(actual, expected) {
+            XCTAssertEqual(a.x, e.x, accuracy: 1e-6, message, line: line)
+            XCTAssertEqual(a.y, e.y, accuracy: 1e-6, message, line: line)
+        }
+    }
+
+    // MARK: - Geometry Tests
+
+    func testPiecePolygonMatchesRotatedAndFlippedTriangles() {
+        for angle in angles {
+            for mirrored in [false, true] {
+                let target = GamePuzzleData.TargetPiece(
+                    id: "t", pieceType: .mediumTriangle, transform: transform(angle: angle, mirrored: mirrored)
+                )
+                assertSamePolygon(
+                    placedPolygon(on: target, angle: angle, mirrored: mirrored),
+                    TangramBounds.computeSKTransformedVertices(for: target),
+                    "triangle angle \(angle) mirrored \(mirrored)"
+                )
+            }
+        }
+    }
+
+    func testPiecePolygonMatchesRotatedAndFlippedParallelograms() {
+        for angle in angles {
+            for mirrored in [false, true] {
+                let target = GamePuzzleData.TargetPiece(
+                    id: "p", pieceType: .parallelogram, transform: transform(angle: angle, mirrored: mirrored)
+                )
+                assertSamePolygon(
+                    placedPolygon(on: target, angle: angle, mirrored: mirrored),
+                    TangramBounds.computeSKTransformedVertices(for: target),
+                    "parallelogram angle \(angle) mirrored \(mirrored)"
+                )
+            }
+        }
+    }
+
+    // MARK: - Scoring Tests
+
+    func testParallelogramWithWrongHandednessDoesNotComplete() {
+        let angle: CGFloat = 0.3
+        let target = GamePuzzleData.TargetPiece(id: "p", pieceType: .parallelogram, transform: transform(angle: angle, mirrored: false))
+        let coverage = TangramSilhouetteCoverage(
+            puzzle: GamePuzzleData(id: "para", name: "para", category: "test", difficulty: 1, targetPieces: [target])
+        )
+        let placed = placedPolygon(on: target, angle: angle, mirrored: false)
+        XCTAssertTrue(coverage.score(polygons: [placed]).isComplete)
+
+        // Same centroid and rotation, opposite side up: a chiral piece only partly covers its mirror image
+        let center = TangramGameGeometry.centerOfVertices(placed)
+        let flipped = TangramSilhouetteCoverage.piecePolygon(pieceType: .parallelogram, position: center, rotation: .pi - angle, isFlipped: false)
+        let score = coverage.score(polygons: [flipped])
+        XCTAssertLessThan(score.coverage, 0.9)
+        XCTAssertFalse(score.isComplete)
+    }
+}
@@ -0,0 +1,73 @@
+//
+//  TangramSilhouetteDescriptorTests.swift
+//  BemoTests
+//
+//  Unit tests for silhouette shape descriptors and the similarity index
+//
+
+import XCTest
+import CoreGraphics
+@testable import Bemo
+
+final class TangramSilhouetteDescriptorTests: XCTestCase {
+
+    // MARK: - Test Data
+
+    /// Square with a small triangle on its right edge and a medium triangle above it
+    private let targets: [GamePuzzleData.TargetPiece] = [
+        .init(id: "square", pieceType: .square, transform: .identity),
+        .init(id: "small", pieceType: .smallTriangle1, transform: CGAffineTransform(translationX: 50, y: 0)),
+        .init(id: "medium", pieceType: .mediumTriangle, transform: CGAffineTransform(translationX: 0, y: 50))
+    ]
+
+    private func puzzle(_ id: String, transform: CGAffineTransform = .identity, targets: [GamePuzzleData.TargetPiece]? = nil) -> GamePuzzleData {
+        GamePuzzleData(
+            id: id,
+            name: id,
+            category: "test",
+            difficulty: 1,
+            targetPieces: (targets ?? self.targets).map {
+                .init(id: $0.id, pieceType: $0.pieceType, transform: $0.transform.concatenating(transform))
+            }
+        )
+    }
+
+    // MARK: - Invariance Tests
+
+    func testDescriptorIgnoresRotationTranslationAndReflection() {
+        let base = TangramSilhouetteDescriptor(puzzle: puzzle("base"))
+        let moved = TangramSilhouetteDescriptor(puzzle: puzzle(
+            "moved",
+            transform: CGAffineTransform(rotationAngle: 0.7).translatedBy(x: 120, y: -40)
+        ))
+        let mirrored = TangramSilhouetteDescriptor(puzzle: puzzle("mirrored", transform: CGAffineTransform(scaleX: -1, y: 1)))
+
+        XCTAssertEqual(base.distance(to: moved), 0, accuracy: 1e-6)
+        XCTAssertEqual(base.distance(to: mirrored), 0, accuracy: 1e-6)
+    }
+
+    func testDescriptorSeparatesDifferentSilhouettes() {
+        var rearranged = targets
+        rearranged[2] = .init(id: "medium", pieceType: .mediumTriangle, transform: CGAffineTransform(translationX: 150, y: 0))
+
+        let base = TangramSilhouetteDescriptor(puzzle: puzzle("base"))
+        let other = TangramSilhouetteDescriptor(puzzle: puzzle("other", targets: rearranged))
+
+        XCTAssertGreaterThan(base.distance(to: other), TangramSilhouetteIndex.duplicateDistance)
+    }
+
+    // MARK: - Index Tests
+
+    func testIndexFindsRotatedCopyAsDuplicate() {
+        var rearranged = targets
+        rearranged[2] = .init(id: "medium", pieceType: .mediumTriangle, transform: CGAffineTransform(translationX: 150, y: 0))
+        let index = TangramSilhouetteIndex(puzzles: [
+            puzzle("base"),
+            puzzle("rotated", transform: CGAffineTransform(rotationAngle: .pi / 2)),
+            puzzle("other", targets: rearranged)
+        ])
+
+        XCTAssertEqual(index.similar(to: "base", limit: 1).first?.puzzleId, "rotated")
+        XCTAssertEqual(index.nearDuplicates().count, 1)
+    }
+}
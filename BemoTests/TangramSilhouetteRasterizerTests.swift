@@ -0,0 +1,127 @@
+//
+//  TangramSilhouetteRasterizerTests.swift
+//  BemoTests
+//
+//  Unit tests for the anti-aliased polygon rasterizer and coverage IoU
+//
+
+import XCTest
+import CoreGraphics
+@testable import Bemo
+
+final class TangramSilhouetteRasterizerTests: XCTestCase {
+
+    // MARK: - Coverage Tests
+
+    func testCoverageAreaMatchesPolygonArea() {
+        let triangle = [CGPoint(x: 2.3, y: 1.7), CGPoint(x: 15.6, y: 3.1), CGPoint(x: 7.2, y: 12.9)]
+        let mask = TangramSilhouetteRasterizer.rasterize([triangle], width: 20, height: 20)
+
+        XCTAssertEqual(mask.area, 71.05, accuracy: 1e-3)
+    }
+
+    func testSharedEdgeHasNoSeam() {
+        let lower = [CGPoint(x: 1.3, y: 1.3), CGPoint(x: 9.7, y: 1.3), CGPoint(x: 9.7, y: 9.7)]
+        let upper = [CGPoint(x: 1.3, y: 1.3), CGPoint(x: 1.3, y: 9.7), CGPoint(x: 9.7, y: 9.7)]
+        let mask = TangramSilhouetteRasterizer.rasterize([lower, upper], width: 12, height: 12)
+
+        // Pixels on the diagonal are split between the two triangles but fully covered
+        XCTAssertEqual(mask.values[5 * 12 + 5], 1, accuracy: 1e-5)
+        XCTAssertEqual(mask.area, 8.4 * 8.4, accuracy: 1e-3)
+    }
+
+    // MARK: - IoU Tests
+
+    func testCoverageIoU() {
+        let square = [CGPoint(x: 0, y: 0), CGPoint(x: 10, y: 0), CGPoint(x: 10, y: 10), CGPoint(x: 0, y: 10)]
+        let halves = [
+            [CGPoint(x: 0, y: 0), CGPoint(x: 10, y: 0), CGPoint(x: 10, y: 10)],
+            [CGPoint(x: 0, y: 0), CGPoint(x: 10, y: 10), CGPoint(x: 0, y: 10)]
+        ]
+        let shifted = square.map { CGPoint(x: $0.x + 5, y: $0.y) }
+
+        XCTAssertEqual(TangramSilhouetteRasterizer.coverageIoU([square], halves), 1, accuracy: 1e-3)
+        XCTAssertEqual(TangramSilhouetteRasterizer.coverageIoU([square], [shifted]), 1.0 / 3.0, accuracy: 1e-2)
+    }
+
+    // MARK: - Thumbnail Tests
+
+    func testOutlineStrokesEachPieceEdge() throws {
+        let square = [CGPoint(x: 0, y: 0), CGPoint(x: 10, y: 0), CGPoint(x: 10, y: 10), CGPoint(x: 0, y: 10)]
+        let red = TangramSilhouetteRasterizer.Color(red: 1, green: 0, blue: 0, alpha: 1)
+        // Fitted at 3.2 px/unit, the square spans pixels 4–36; a 2 pt stroke covers 3–5 on its left edge
+        let image = try XCTUnwrap(TangramSilhouetteRasterizer.renderImage(
+            layers: [.init(polygons: [square], color: red, outline: .black)],
+            size: CGSize(width: 40, height: 40),
+            scale: 1,
+            outlineWidth: 2
+        ))
+        let pixels = try XCTUnwrap(image.dataProvider?.data as Data?)
+        func rgb(x: Int, y: Int) -> [UInt8] {
+            let i = (y * 40 + x) * 4
+            return [pixels[i], pixels[i + 1], pixels[i + 2]]
+        }
+
+        XCTAssertEqual(rgb(x: 20, y: 20), [255, 0, 0])
+        XCTAssertEqual(rgb(x: 3, y: 20), [0, 0, 0])
+        XCTAssertEqual(rgb(x: 4, y: 20), [0, 0, 0])
+        XCTAssertEqual(rgb(x: 1, y: 20), [255, 255, 255])
+    }
+
+    // MARK: - Silhouette Coverage Tests
+
+    func testCoverageScoreIgnoresWhichPieceFillsWhichTarget() {
+        let puzzle = GamePuzzleData(
+            id: "pair",
+            name: "pair",
+            category: "test",
+            difficulty: 1,
+            targetPieces: [
+                .init(id: "a", pieceType: .largeTriangle1, transform: .identity),
+                .init(id: "b", pieceType: .largeTriangle2, transform: CGAffineTransform(translationX: 200, y: 0))
+            ]
+        )
+        let coverage = TangramSilhouetteCoverage(puzzle: puzzle)
+        let targets = puzzle.targetPieces.map { TangramBounds.computeSKTransformedVertices(for: $0) }
+
+        // Same polygons listed in swapped order, as interchangeable pieces would report them
+        let full = coverage.score(polygons: Array(targets.reversed()))
+        XCTAssertTrue(full.isComplete)
+        XCTAssertEqual(full.progress, 1, accuracy: 1e-3)
+
+        let half = coverage.score(polygons: [targets[0]])
+        XCTAssertFalse(half.isComplete)
+        XCTAssertEqual(half.coverage, 0.5, accuracy: 1e-2)
+        XCTAssertEqual(half.overflow, 0, accuracy: 1e-3)
+    }
+
+    func testPieceReachingPastTheFrameCountsFullOverflow() {
+        let puzzle = GamePuzzleData(
+            id: "single",
+            name: "single",
+            category: "test",
+            difficulty: 1,
+            targetPieces: [.init(id: "s", pieceType: .square, transform: .identity)]
+        )
+        let coverage = TangramSilhouetteCoverage(puzzle: puzzle)
+        let target = TangramBounds.computeSKTransformedVertices(for: puzzle.targetPieces[0])
+        let center = TangramGameGeometry.centerOfVertices(target)
+        let side = TangramGameConstants.visualScale
+
+        // Mapped piece posed on its target through the same geometry the validation engine uses
+        let placed = TangramSilhouetteCoverage.piecePolygon(pieceType: .square, position: center, rotation: 0, isFlipped: false)
+        XCTAssertTrue(coverage.score(polygons: [placed]).isComplete)
+
+        // Half the piece hangs off the side, well past the silhouette's framing margin
+        let offset = TangramSilhouetteCoverage.piecePolygon(
+            pieceType: .square,
+            position: CGPoint(x: center.x + side / 2, y: center.y),
+            rotation: 0,
+            isFlipped: false
+        )
+        let half = coverage.score(polygons: [offset])
+        XCTAssertEqual(half.coverage, 0.5, accuracy: 1e-2)
+        XCTAssertEqual(half.overflow, 0.5, accuracy: 1e-2)
+        XCTAssertFalse(half.isComplete)
+    }
+}
@@ -0,0 +1,321 @@
+// Pure classification logic shared by the edge function (index.ts) and the local batch CLI (cli.ts).
+// No Supabase or network dependencies so it can run anywhere Deno runs.
+
+export type Transform = { a: number; b: number; c: number; d: number; tx: number; ty: number }
+export type Piece = { id: string; type?: string; pieceType?: string; transform: Transform }
+export type Connection = { id: string; type: unknown; constraint?: { type?: string } }
+
+export type PuzzleRow = {
+  puzzle_id: string
+  name: string
+  difficulty: number
+  puzzle_data: Record<string, unknown>
+  tags: string[] | null
+  metadata: Record<string, unknown> | null
+}
+
+export type SkillProfile = {
+  shape_matching: number
+  mental_rotation: number
+  reflection: number
+  decomposition: number
+  planning_sequencing: number
+}
+
+export type ShapeMetrics = {
+  // Pairs of pieces sharing an edge segment
+  edge_contacts: number
+  // Silhouette area / convex hull area (1 = fully convex)
+  convexity: number
+  // Mean number of connected next-piece choices while building outward from the largest piece
+  branching_factor: number
+}
+
+export type Classification = { profile: SkillProfile; tags: string[]; shape_metrics: ShapeMetrics | null }
+
+function atan2Deg(b: number, a: number): number {
+  const ang = Math.atan2(b, a)
+  return (ang * 180) / Math.PI
+}
+
+function rotationMetrics(pieces: Piece[]) {
+  const epsilonDeg = 5
+  let nonZero = 0
+  let sumNorm = 0
+  for (const p of pieces) {
+    const deg = Math.abs(atan2Deg(p.transform.b, p.transform.a))
+    const isZero = deg < epsilonDeg
+    if (!isZero) nonZero += 1
+    // normalize by 90° (π/2) cap
+    const capped = Math.min(deg, 90)
+    sumNorm += capped / 90
+  }
+  const count = Math.max(1, pieces.length)
+  return {
+    fraction: nonZero / count,
+    intensity: sumNorm / count,
+  }
+}
+
+function isFlipped(t: Transform): boolean {
+  const det = t.a * t.d - t.b * t.c
+  return det < 0
+}
+
+function reflectionMetric(pieces: Piece[]) {
+  let flipped = 0
+  let parallelogramFlipBonus = 0
+  for (const p of pieces) {
+    if (isFlipped(p.transform)) {
+      flipped += 1
+      const kind = (p.type || p.pieceType || '').toLowerCase()
+      if (kind.includes('parallelogram')) parallelogramFlipBonus += 0.05
+    }
+  }
+  const frac = flipped / Math.max(1, pieces.length)
+  return Math.min(1, frac + parallelogramFlipBonus)
+}
+
+function decompositionMetric(pieces: Piece[], connections?: Connection[]) {
+  if (!connections || !Array.isArray(connections) || connections.length === 0) return 0
+  // Approximate density by edges per piece
+  const density = connections.length / Math.max(1, pieces.length)
+  // heuristically clamp to [0,1] assuming ~3 edges per piece is "high"
+  return Math.min(1, density / 3)
+}
+
+function planningMetric(pieces: Piece[], connections?: Connection[]) {
+  // Heuristic: more constraints + more orientation diversity → higher planning
+  let fixedCount = 0
+  let rotationBucketSet = new Set<number>()
+  for (const p of pieces) {
+    const deg = Math.abs(atan2Deg(p.transform.b, p.transform.a))
+    // bucket by 45°
+    const bucket = Math.round(deg / 45)
+    rotationBucketSet.add(bucket)
+  }
+  if (connections && Array.isArray(connections)) {
+    for (const c of connections) {
+      const t = (c as any)?.constraint?.type
+      if (typeof t === 'string' && t.toLowerCase().includes('fixed')) fixedCount += 1
+    }
+  }
+  const diversity = Math.min(1, rotationBucketSet.size / 4) // up to 4 buckets contributes fully
+  const fixedScore = Math.min(1, fixedCount / Math.max(1, pieces.length))
+  return Math.min(1, 0.6 * diversity + 0.4 * fixedScore)
+}
+
+// ---------------------------------------------------------------------------
+// Geometry (mirrors TangramGameGeometry.normalizedVertices and visualScale in the app)
+
+type Point = { x: number; y: number }
+
+const VISUAL_SCALE = 50
+const SQRT2 = Math.SQRT2
+const HALF_SQRT2 = SQRT2 / 2
+
+const NORMALIZED_VERTICES: Record<string, Point[]> = {
+  smalltriangle: [{ x: 0, y: 0 }, { x: 1, y: 0 }, { x: 0, y: 1 }],
+  mediumtriangle: [{ x: 0, y: 0 }, { x: SQRT2, y: 0 }, { x: 0, y: SQRT2 }],
+  largetriangle: [{ x: 0, y: 0 }, { x: 2, y: 0 }, { x: 0, y: 2 }],
+  square: [{ x: 0, y: 0 }, { x: 1, y: 0 }, { x: 1, y: 1 }, { x: 0, y: 1 }],
+  parallelogram: [{ x: 0, y: 0 }, { x: SQRT2, y: 0 }, { x: HALF_SQRT2, y: HALF_SQRT2 }, { x: -HALF_SQRT2, y: HALF_SQRT2 }],
+}
+
+// Contact detection tolerances in scaled units
+const CONTACT_DISTANCE = 3
+const CONTACT_MIN_OVERLAP = 5
+const CONTACT_PARALLEL_SIN = Math.sin((5 * Math.PI) / 180)
+
+function pieceVertices(p: Piece): Point[] | null {
+  const kind = (p.type || p.pieceType || '').toLowerCase().replace(/[0-9]/g, '')
+  const base = NORMALIZED_VERTICES[kind]
+  if (!base || !p.transform) return null
+  const t = p.transform
+  return base.map((v) => {
+    const x = v.x * VISUAL_SCALE
+    const y = v.y * VISUAL_SCALE
+    return { x: t.a * x + t.c * y + t.tx, y: t.b * x + t.d * y + t.ty }
+  })
+}
+
+function polygonArea(poly: Point[]): number {
+  let sum = 0
+  for (let i = 0; i < poly.length; i++) {
+    const p = poly[i]
+    const q = poly[(i + 1) % poly.length]
+    sum += p.x * q.y - q.x * p.y
+  }
+  return Math.abs(sum) / 2
+}
+
+function convexHull(points: Point[]): Point[] {
+  const pts = [...points].sort((p, q) => (p.x === q.x ? p.y - q.y : p.x - q.x))
+  if (pts.length < 3) return pts
+  const cross = (o: Point, a: Point, b: Point) => (a.x - o.x) * (b.y - o.y) - (a.y - o.y) * (b.x - o.x)
+  const lower: Point[] = []
+  for (const p of pts) {
+    while (lower.length >= 2 && cross(lower[lower.length - 2], lower[lower.length - 1], p) <= 0) lower.pop()
+    lower.push(p)
+  }
+  const upper: Point[] = []
+  for (let i = pts.length - 1; i >= 0; i--) {
+    const p = pts[i]
+    while (upper.length >= 2 && cross(upper[upper.length - 2], upper[upper.length - 1], p) <= 0) upper.pop()
+    upper.push(p)
+  }
+  return lower.slice(0, -1).concat(upper.slice(0, -1))
+}
+
+// Two polygons touch along an edge if some pair of edges is parallel, collinear and overlaps
+function shareEdge(a: Point[], b: Point[]): boolean {
+  for (let i = 0; i < a.length; i++) {
+    const a0 = a[i]
+    const a1 = a[(i + 1) % a.length]
+    const ux = a1.x - a0.x
+    const uy = a1.y - a0.y
+    const len = Math.hypot(ux, uy)
+    if (len === 0) continue
+    const dx = ux / len
+    const dy = uy / len
+    for (let j = 0; j < b.length; j++) {
+      const b0 = b[j]
+      const b1 = b[(j + 1) % b.length]
+      const vx = b1.x - b0.x
+      const vy = b1.y - b0.y
+      const vlen = Math.hypot(vx, vy)
+      if (vlen === 0) continue
+      if (Math.abs(dx * vy - dy * vx) / vlen > CONTACT_PARALLEL_SIN) continue
+      // Perpendicular distance of b's endpoints from a's supporting line
+      const dist0 = Math.abs(dx * (b0.y - a0.y) - dy * (b0.x - a0.x))
+      const dist1 = Math.abs(dx * (b1.y - a0.y) - dy * (b1.x - a0.x))
+      if (Math.max(dist0, dist1) > CONTACT_DISTANCE) continue
+      // Overlap of projections along a's direction
+      const s0 = dx * (b0.x - a0.x) + dy * (b0.y - a0.y)
+      const s1 = dx * (b1.x - a0.x) + dy * (b1.y - a0.y)
+      const overlap = Math.min(len, Math.max(s0, s1)) - Math.max(0, Math.min(s0, s1))
+      if (overlap > CONTACT_MIN_OVERLAP) return true
+    }
+  }
+  return false
+}
+
+export function shapeMetrics(pieces: Piece[]): ShapeMetrics | null {
+  const polygons = pieces.map(pieceVertices)
+  if (polygons.length === 0 || polygons.some((p) => p === null)) return null
+  const polys = polygons as Point[][]
+  const n = polys.length
+
+  const adjacency: number[][] = polys.map(() => [])
+  let edgeContacts = 0
+  for (let i = 0; i < n; i++) {
+    for (let j = i + 1; j < n; j++) {
+      if (shareEdge(polys[i], polys[j])) {
+        adjacency[i].push(j)
+        adjacency[j].push(i)
+        edgeContacts += 1
+      }
+    }
+  }
+
+  const silhouetteArea = polys.reduce((sum, p) => sum + polygonArea(p), 0)
+  const hullArea = polygonArea(convexHull(polys.flat()))
+  const convexity = hullArea > 0 ? Math.min(1, silhouetteArea / hullArea) : 1
+
+  // Build outward from the largest piece, always taking the lowest-index frontier piece,
+  // and average how many connected choices were available at each step
+  let start = 0
+  for (let i = 1; i < n; i++) if (polygonArea(polys[i]) > polygonArea(polys[start])) start = i
+  const built = new Set<number>([start])
+  let choiceSum = 0
+  let steps = 0
+  while (built.size < n) {
+    const frontier = new Set<number>()
+    for (const i of built) for (const j of adjacency[i]) if (!built.has(j)) frontier.add(j)
+    if (frontier.size === 0) break
+    choiceSum += frontier.size
+    steps += 1
+    built.add(Math.min(...frontier))
+  }
+
+  return {
+    edge_contacts: edgeContacts,
+    convexity,
+    branching_factor: steps > 0 ? choiceSum / steps : 0,
+  }
+}
+
+// ---------------------------------------------------------------------------
+
+function versionNumber(classifierVersion: string): number {
+  const match = /^v(\d+)/.exec(classifierVersion)
+  return match ? parseInt(match[1], 10) : 1
+}
+
+export function computeSkillProfile(puzzle: PuzzleRow, classifierVersion: string): Classification {
+  const data = puzzle.puzzle_data || {}
+  const pieces = (data as any).pieces as Piece[] | undefined
+  const connections = (data as any).connections as Connection[] | undefined
+  if (!pieces || !Array.isArray(pieces) || pieces.length === 0) {
+    const prof: SkillProfile = {
+      shape_matching: 1,
+      mental_rotation: 0,
+      reflection: 0,
+      decomposition: 0,
+      planning_sequencing: 0,
+    }
+    return { profile: prof, tags: ['matching_only'], shape_metrics: null }
+  }
+
+  const rot = rotationMetrics(pieces)
+  const refl = reflectionMetric(pieces)
+  let decomp = decompositionMetric(pieces, connections)
+  let plan = planningMetric(pieces, connections)
+  const shape = shapeMetrics(pieces)
+
+  // v2+: geometry-derived signals. v1 output is unchanged so existing rows stay comparable.
+  if (versionNumber(classifierVersion) >= 2 && shape) {
+    // Fall back to measured contacts when the editor did not record connections
+    const contactDensity = Math.min(1, shape.edge_contacts / Math.max(1, pieces.length) / 3)
+    const density = decomp > 0 ? decomp : contactDensity
+    decomp = Math.min(1, 0.7 * density + 0.3 * (1 - shape.convexity))
+    // Few connected choices per step means the build order matters more
+    const sequencing = shape.branching_factor > 0 ? 1 / shape.branching_factor : 0
+    plan = Math.min(1, 0.7 * plan + 0.3 * sequencing)
+  }
+
+  // Raw others before normalization
+  let mental_rotation = Math.min(1, 0.5 * rot.fraction + 0.5 * rot.intensity)
+  let reflection = Math.min(1, refl)
+  let decomposition = Math.min(1, decomp)
+  let planning_sequencing = Math.min(1, plan)
+
+  // shape matching baseline
+  let others = mental_rotation + reflection + decomposition + planning_sequencing
+  let shape_matching = Math.max(0.1, 1 - others)
+
+  // Normalize sum to 1 (allow slight slack due to baseline)
+  const sum = shape_matching + others
+  if (sum > 1.00001) {
+    shape_matching /= sum
+    mental_rotation /= sum
+    reflection /= sum
+    decomposition /= sum
+    planning_sequencing /= sum
+  }
+
+  const profile: SkillProfile = { shape_matching, mental_rotation, reflection, decomposition, planning_sequencing }
+
+  // Tags
+  const tags: string[] = []
+  if (mental_rotation >= 0.3) tags.push('rotation_30plus')
+  if (reflection >= 0.1) tags.push('reflection_present')
+  if (decomposition >= 0.3) tags.push('decomp_high')
+  if (planning_sequencing >= 0.3) tags.push('plan_high')
+
+  return { profile, tags, shape_metrics: shape }
+}
+
+export function uniq<T>(arr: T[]): T[] {
+  return Array.from(new Set(arr))
+}
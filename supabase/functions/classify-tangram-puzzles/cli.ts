@@ -0,0 +1,56 @@
+// Local batch classifier over puzzle dumps. Uses the same classifier.ts as the edge function,
+// so the emitted skill_profile JSON is identical to what the function would write.
+//
+// Usage:
+//   deno run --allow-read cli.ts [--classifier-version v2] dump.json [more.json ...] > profiles.ndjson
+//
+// Each dump is a JSON array of tangram_puzzles rows (puzzle_id, name, difficulty, puzzle_data, tags, metadata).
+// Writes one JSON line per puzzle to stdout and a summary to stderr.
+
+import { computeSkillProfile, uniq, type PuzzleRow } from './classifier.ts'
+
+function parseArgs(args: string[]): { classifierVersion: string; files: string[] } {
+  let classifierVersion = 'v1'
+  const files: string[] = []
+  for (let i = 0; i < args.length; i++) {
+    if (args[i] === '--classifier-version' && i + 1 < args.length) {
+      classifierVersion = args[++i]
+    } else {
+      files.push(args[i])
+    }
+  }
+  return { classifierVersion, files }
+}
+
+async function readRows(path: string): Promise<PuzzleRow[]> {
+  const parsed = JSON.parse(await Deno.readTextFile(path))
+  if (!Array.isArray(parsed)) throw new Error(`${path}: expected a JSON array of puzzle rows`)
+  return parsed as PuzzleRow[]
+}
+
+const { classifierVersion, files } = parseArgs(Deno.args)
+if (files.length === 0) {
+  console.error('usage: deno run --allow-read cli.ts [--classifier-version v2] dump.json [more.json ...]')
+  Deno.exit(2)
+}
+
+const started = performance.now()
+const rows = (await Promise.all(files.map(readRows))).flat()
+
+for (const row of rows) {
+  const { profile, tags, shape_metrics } = computeSkillProfile(row, classifierVersion)
+  console.log(
+    JSON.stringify({
+      puzzle_id: row.puzzle_id,
+      name: row.name,
+      piece_count: (row.puzzle_data as any)?.pieces?.length ?? 0,
+      weights: profile,
+      shape_metrics,
+      tags: uniq([...(row.tags || []), ...tags]),
+      classifier_version: classifierVersion,
+    }),
+  )
+}
+
+const elapsed = (performance.now() - started).toFixed(1)
+console.error(`Classified ${rows.length} puzzles from ${files.length} file(s) in ${elapsed} ms (classifier_version=${classifierVersion})`)